@@ -0,0 +1,752 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticBVH.h"
+
+namespace AcousticBVH
+{
+    /** Hits closer than this to the ray origin are ignored (avoids re-hitting a surface a ray starts on) */
+    constexpr float RayEpsilon = 0.1f;
+
+    /** Determinants below this are treated as rays parallel to the triangle */
+    constexpr float DeterminantEpsilon = 1e-8f;
+
+    /** Deeper nodes become leaves regardless of size - bounds the traversal stacks */
+    constexpr int32 MaxDepth = 64;
+
+    /** Relative cost of a node visit against a triangle test */
+    constexpr float TraversalCost = 1.0f;
+
+    FORCEINLINE float HalfArea(const FBox3f& Box)
+    {
+        if (!Box.IsValid)
+        {
+            return 0.0f;
+        }
+        const FVector3f Extent = Box.Max - Box.Min;
+        return Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X;
+    }
+
+    FORCEINLINE float SafeInverse(float Value)
+    {
+        return FMath::Abs(Value) > UE_SMALL_NUMBER ? 1.0f / Value : (Value < 0.0f ? -UE_BIG_NUMBER : UE_BIG_NUMBER);
+    }
+
+    /** Entry distance of a ray into a box, or MAX_flt if it misses within MaxDistance */
+    FORCEINLINE float RayBoxDistance(const FVector3f& BoundsMin, const FVector3f& BoundsMax,
+        const FVector3f& Origin, const FVector3f& InvDirection, float MaxDistance)
+    {
+        const FVector3f T1 = (BoundsMin - Origin) * InvDirection;
+        const FVector3f T2 = (BoundsMax - Origin) * InvDirection;
+        const float TNear = T1.ComponentMin(T2).GetMax();
+        const float TFar = T1.ComponentMax(T2).GetMin();
+        return (TNear <= TFar && TFar >= 0.0f && TNear < MaxDistance) ? FMath::Max(TNear, 0.0f) : MAX_flt;
+    }
+
+    /** A ray packet transposed to SoA registers */
+    struct FPacketLanes
+    {
+        VectorRegister4Float OX, OY, OZ;
+        VectorRegister4Float DX, DY, DZ;
+        VectorRegister4Float IX, IY, IZ;
+
+        /** Padded lanes get a negative max distance so every test rejects them */
+        explicit FPacketLanes(const FAcousticRayPacket& Packet, float OutMaxDistances[FAcousticRayPacket::Width])
+        {
+            float Lanes[9][FAcousticRayPacket::Width];
+            for (int32 Lane = 0; Lane < FAcousticRayPacket::Width; ++Lane)
+            {
+                const int32 Source = FMath::Min(Lane, Packet.NumRays - 1);
+                const FVector3f& Origin = Packet.Origins[Source];
+                const FVector3f& Direction = Packet.Directions[Source];
+
+                Lanes[0][Lane] = Origin.X;
+                Lanes[1][Lane] = Origin.Y;
+                Lanes[2][Lane] = Origin.Z;
+                Lanes[3][Lane] = Direction.X;
+                Lanes[4][Lane] = Direction.Y;
+                Lanes[5][Lane] = Direction.Z;
+                Lanes[6][Lane] = SafeInverse(Direction.X);
+                Lanes[7][Lane] = SafeInverse(Direction.Y);
+                Lanes[8][Lane] = SafeInverse(Direction.Z);
+                OutMaxDistances[Lane] = Lane < Packet.NumRays ? Packet.MaxDistances[Lane] : -1.0f;
+            }
+
+            OX = VectorLoad(Lanes[0]);
+            OY = VectorLoad(Lanes[1]);
+            OZ = VectorLoad(Lanes[2]);
+            DX = VectorLoad(Lanes[3]);
+            DY = VectorLoad(Lanes[4]);
+            DZ = VectorLoad(Lanes[5]);
+            IX = VectorLoad(Lanes[6]);
+            IY = VectorLoad(Lanes[7]);
+            IZ = VectorLoad(Lanes[8]);
+        }
+
+        /** Lanes that enter a box before their max distance */
+        FORCEINLINE int32 TestBox(const FVector3f& BoundsMin, const FVector3f& BoundsMax, const VectorRegister4Float& TMax) const
+        {
+            const VectorRegister4Float T1X = VectorMultiply(VectorSubtract(VectorSetFloat1(BoundsMin.X), OX), IX);
+            const VectorRegister4Float T2X = VectorMultiply(VectorSubtract(VectorSetFloat1(BoundsMax.X), OX), IX);
+            const VectorRegister4Float T1Y = VectorMultiply(VectorSubtract(VectorSetFloat1(BoundsMin.Y), OY), IY);
+            const VectorRegister4Float T2Y = VectorMultiply(VectorSubtract(VectorSetFloat1(BoundsMax.Y), OY), IY);
+            const VectorRegister4Float T1Z = VectorMultiply(VectorSubtract(VectorSetFloat1(BoundsMin.Z), OZ), IZ);
+            const VectorRegister4Float T2Z = VectorMultiply(VectorSubtract(VectorSetFloat1(BoundsMax.Z), OZ), IZ);
+
+            const VectorRegister4Float TNear = VectorMax(VectorMax(VectorMin(T1X, T2X), VectorMin(T1Y, T2Y)), VectorMin(T1Z, T2Z));
+            const VectorRegister4Float TFar = VectorMin(VectorMin(VectorMax(T1X, T2X), VectorMax(T1Y, T2Y)), VectorMax(T1Z, T2Z));
+
+            const VectorRegister4Float Mask = VectorBitwiseAnd(
+                VectorBitwiseAnd(VectorCompareLE(TNear, TFar), VectorCompareGE(TFar, VectorZeroFloat())),
+                VectorCompareLT(TNear, TMax));
+            return VectorMaskBits(Mask);
+        }
+    };
+}
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+void FAcousticBVH::Reset()
+{
+    Nodes.Empty();
+    Triangles.Empty();
+    PrimitiveIds.Empty();
+}
+
+void FAcousticBVH::Build(TConstArrayView<FVector3f> TriangleVertices)
+{
+    Reset();
+
+    const int32 NumTriangles = TriangleVertices.Num() / 3;
+    if (NumTriangles == 0)
+    {
+        return;
+    }
+
+    TArray<FVector3f> Centroids;
+    TArray<FBox3f> TriangleBounds;
+    Centroids.SetNumUninitialized(NumTriangles);
+    TriangleBounds.SetNumUninitialized(NumTriangles);
+
+    for (int32 TriIndex = 0; TriIndex < NumTriangles; ++TriIndex)
+    {
+        const FVector3f& A = TriangleVertices[TriIndex * 3 + 0];
+        const FVector3f& B = TriangleVertices[TriIndex * 3 + 1];
+        const FVector3f& C = TriangleVertices[TriIndex * 3 + 2];
+
+        FBox3f Bounds(ForceInit);
+        Bounds += A;
+        Bounds += B;
+        Bounds += C;
+
+        TriangleBounds[TriIndex] = Bounds;
+        Centroids[TriIndex] = (A + B + C) / 3.0f;
+    }
+
+    BuildTree(TriangleBounds, Centroids);
+
+    // Leaf-order triangles in the layout the intersection tests want
+    Triangles.SetNumUninitialized(NumTriangles);
+    for (int32 Index = 0; Index < NumTriangles; ++Index)
+    {
+        const int32 SourceIndex = PrimitiveIds[Index];
+        const FVector3f& A = TriangleVertices[SourceIndex * 3 + 0];
+
+        FTriangle& Triangle = Triangles[Index];
+        Triangle.V0 = A;
+        Triangle.Edge1 = TriangleVertices[SourceIndex * 3 + 1] - A;
+        Triangle.Edge2 = TriangleVertices[SourceIndex * 3 + 2] - A;
+    }
+}
+
+void FAcousticBVH::BuildFromBounds(TConstArrayView<FBox3f> PrimitiveBounds)
+{
+    Reset();
+
+    if (PrimitiveBounds.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<FBox3f> Bounds(PrimitiveBounds);
+    TArray<FVector3f> Centroids;
+    Centroids.SetNumUninitialized(Bounds.Num());
+    for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+    {
+        Centroids[Index] = Bounds[Index].GetCenter();
+    }
+
+    BuildTree(Bounds, Centroids);
+}
+
+void FAcousticBVH::BuildTree(TArray<FBox3f>& PrimitiveBounds, TArray<FVector3f>& Centroids)
+{
+    // Per-primitive build data is permuted alongside PrimitiveIds as nodes split
+    const int32 NumPrimitives = PrimitiveBounds.Num();
+    PrimitiveIds.SetNumUninitialized(NumPrimitives);
+    for (int32 Index = 0; Index < NumPrimitives; ++Index)
+    {
+        PrimitiveIds[Index] = Index;
+    }
+
+    Nodes.Reserve(NumPrimitives * 2);
+    FNode& Root = Nodes.AddDefaulted_GetRef();
+    Root.LeftOrFirst = 0;
+    Root.Count = NumPrimitives;
+    UpdateNodeBounds(0, PrimitiveBounds);
+
+    // Depth-first so siblings stay adjacent
+    TArray<TPair<int32, int32>, TInlineAllocator<AcousticBVH::MaxDepth>> BuildStack;
+    BuildStack.Emplace(0, 0);
+
+    while (BuildStack.Num() > 0)
+    {
+        const TPair<int32, int32> Entry = BuildStack.Pop(EAllowShrinking::No);
+        if (Entry.Value >= AcousticBVH::MaxDepth || !SplitNode(Entry.Key, Centroids, PrimitiveBounds))
+        {
+            continue;
+        }
+
+        const int32 LeftChild = Nodes[Entry.Key].LeftOrFirst;
+        BuildStack.Emplace(LeftChild + 1, Entry.Value + 1);
+        BuildStack.Emplace(LeftChild, Entry.Value + 1);
+    }
+
+    Nodes.Shrink();
+}
+
+void FAcousticBVH::UpdateNodeBounds(int32 NodeIndex, const TArray<FBox3f>& PrimitiveBounds)
+{
+    FNode& Node = Nodes[NodeIndex];
+
+    FBox3f Bounds(ForceInit);
+    for (int32 Index = Node.LeftOrFirst; Index < Node.LeftOrFirst + Node.Count; ++Index)
+    {
+        Bounds += PrimitiveBounds[Index];
+    }
+
+    Node.BoundsMin = Bounds.Min;
+    Node.BoundsMax = Bounds.Max;
+}
+
+void FAcousticBVH::Refit(TConstArrayView<FBox3f> PrimitiveBounds)
+{
+    check(PrimitiveBounds.Num() == PrimitiveIds.Num());
+
+    // Children follow their parent, so a reverse walk sees every child before its parent
+    for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; --NodeIndex)
+    {
+        FNode& Node = Nodes[NodeIndex];
+
+        FBox3f Bounds(ForceInit);
+        if (Node.IsLeaf())
+        {
+            for (int32 Index = Node.LeftOrFirst; Index < Node.LeftOrFirst + Node.Count; ++Index)
+            {
+                Bounds += PrimitiveBounds[PrimitiveIds[Index]];
+            }
+        }
+        else
+        {
+            const FNode& Left = Nodes[Node.LeftOrFirst];
+            const FNode& Right = Nodes[Node.LeftOrFirst + 1];
+            Bounds = FBox3f(Left.BoundsMin.ComponentMin(Right.BoundsMin), Left.BoundsMax.ComponentMax(Right.BoundsMax));
+        }
+
+        Node.BoundsMin = Bounds.Min;
+        Node.BoundsMax = Bounds.Max;
+    }
+}
+
+float FAcousticBVH::GetTreeCost() const
+{
+    float Cost = 0.0f;
+    for (const FNode& Node : Nodes)
+    {
+        Cost += AcousticBVH::HalfArea(FBox3f(Node.BoundsMin, Node.BoundsMax));
+    }
+    return Cost;
+}
+
+bool FAcousticBVH::SplitNode(int32 NodeIndex, TArray<FVector3f>& Centroids, TArray<FBox3f>& PrimitiveBounds)
+{
+    const FNode Node = Nodes[NodeIndex];
+    if (Node.Count <= MaxLeafTriangles)
+    {
+        return false;
+    }
+
+    const int32 First = Node.LeftOrFirst;
+    const int32 Last = First + Node.Count;
+
+    FBox3f CentroidBounds(ForceInit);
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        CentroidBounds += Centroids[Index];
+    }
+
+    // Binned SAH: pick the cheapest of NumBins - 1 planes on each axis
+    int32 BestAxis = INDEX_NONE;
+    int32 BestSplit = 0;
+    float BestCost = MAX_flt;
+
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        const float AxisMin = CentroidBounds.Min[Axis];
+        const float AxisExtent = CentroidBounds.Max[Axis] - AxisMin;
+        if (AxisExtent <= UE_KINDA_SMALL_NUMBER)
+        {
+            continue;
+        }
+
+        FBox3f BinBounds[NumBins];
+        int32 BinCounts[NumBins] = {};
+        for (FBox3f& Bounds : BinBounds)
+        {
+            Bounds.Init();
+        }
+
+        const float BinScale = NumBins / AxisExtent;
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            const int32 Bin = FMath::Min(NumBins - 1, static_cast<int32>((Centroids[Index][Axis] - AxisMin) * BinScale));
+            BinCounts[Bin]++;
+            BinBounds[Bin] += PrimitiveBounds[Index];
+        }
+
+        // Sweep from the left, then from the right, to get both sides of every plane
+        float LeftAreas[NumBins - 1];
+        int32 LeftCounts[NumBins - 1];
+        FBox3f Accumulated(ForceInit);
+        int32 Count = 0;
+        for (int32 Plane = 0; Plane < NumBins - 1; ++Plane)
+        {
+            Accumulated += BinBounds[Plane];
+            Count += BinCounts[Plane];
+            LeftAreas[Plane] = AcousticBVH::HalfArea(Accumulated);
+            LeftCounts[Plane] = Count;
+        }
+
+        Accumulated.Init();
+        Count = 0;
+        for (int32 Plane = NumBins - 2; Plane >= 0; --Plane)
+        {
+            Accumulated += BinBounds[Plane + 1];
+            Count += BinCounts[Plane + 1];
+
+            const float Cost = LeftCounts[Plane] * LeftAreas[Plane] + Count * AcousticBVH::HalfArea(Accumulated);
+            if (Cost < BestCost)
+            {
+                BestCost = Cost;
+                BestAxis = Axis;
+                BestSplit = Plane + 1;
+            }
+        }
+    }
+
+    // All centroids coincide, or splitting costs more than testing every primitive
+    const float NodeArea = AcousticBVH::HalfArea(FBox3f(Node.BoundsMin, Node.BoundsMax));
+    if (BestAxis == INDEX_NONE || AcousticBVH::TraversalCost * NodeArea + BestCost >= Node.Count * NodeArea)
+    {
+        return false;
+    }
+
+    // Partition the range in place around the chosen plane
+    const float AxisMin = CentroidBounds.Min[BestAxis];
+    const float BinScale = NumBins / (CentroidBounds.Max[BestAxis] - AxisMin);
+
+    int32 Left = First;
+    int32 Right = Last - 1;
+    while (Left <= Right)
+    {
+        const int32 Bin = FMath::Min(NumBins - 1, static_cast<int32>((Centroids[Left][BestAxis] - AxisMin) * BinScale));
+        if (Bin < BestSplit)
+        {
+            Left++;
+        }
+        else
+        {
+            Swap(Centroids[Left], Centroids[Right]);
+            Swap(PrimitiveBounds[Left], PrimitiveBounds[Right]);
+            Swap(PrimitiveIds[Left], PrimitiveIds[Right]);
+            Right--;
+        }
+    }
+
+    const int32 LeftCount = Left - First;
+    if (LeftCount == 0 || LeftCount == Node.Count)
+    {
+        return false;
+    }
+
+    const int32 LeftChild = Nodes.AddDefaulted(2);
+    Nodes[LeftChild].LeftOrFirst = First;
+    Nodes[LeftChild].Count = LeftCount;
+    Nodes[LeftChild + 1].LeftOrFirst = Left;
+    Nodes[LeftChild + 1].Count = Node.Count - LeftCount;
+    UpdateNodeBounds(LeftChild, PrimitiveBounds);
+    UpdateNodeBounds(LeftChild + 1, PrimitiveBounds);
+
+    Nodes[NodeIndex].LeftOrFirst = LeftChild;
+    Nodes[NodeIndex].Count = 0;
+    return true;
+}
+
+// ============================================================================
+// SINGLE RAY
+// ============================================================================
+
+FAcousticBVHHit FAcousticBVH::Intersect(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance) const
+{
+    FAcousticBVHHit Hit;
+    if (Nodes.Num() == 0)
+    {
+        return Hit;
+    }
+
+    const FVector3f InvDirection(
+        AcousticBVH::SafeInverse(Direction.X),
+        AcousticBVH::SafeInverse(Direction.Y),
+        AcousticBVH::SafeInverse(Direction.Z));
+
+    float BestDistance = MaxDistance;
+    int32 BestTriangle = INDEX_NONE;
+
+    if (AcousticBVH::RayBoxDistance(Nodes[0].BoundsMin, Nodes[0].BoundsMax, Origin, InvDirection, BestDistance) == MAX_flt)
+    {
+        return Hit;
+    }
+
+    // Far children with their entry distance, so they can be culled once a closer hit is known
+    TPair<int32, float> Stack[AcousticBVH::MaxDepth + 1];
+    int32 StackSize = 0;
+    int32 NodeIndex = 0;
+
+    while (true)
+    {
+        const FNode& Node = Nodes[NodeIndex];
+
+        if (Node.IsLeaf())
+        {
+            for (int32 Index = Node.LeftOrFirst; Index < Node.LeftOrFirst + Node.Count; ++Index)
+            {
+                // Moller-Trumbore, two-sided
+                const FTriangle& Triangle = Triangles[Index];
+                const FVector3f P = FVector3f::CrossProduct(Direction, Triangle.Edge2);
+                const float Det = FVector3f::DotProduct(Triangle.Edge1, P);
+                if (FMath::Abs(Det) < AcousticBVH::DeterminantEpsilon)
+                {
+                    continue;
+                }
+
+                const float InvDet = 1.0f / Det;
+                const FVector3f T = Origin - Triangle.V0;
+                const float U = FVector3f::DotProduct(T, P) * InvDet;
+                if (U < 0.0f || U > 1.0f)
+                {
+                    continue;
+                }
+
+                const FVector3f Q = FVector3f::CrossProduct(T, Triangle.Edge1);
+                const float V = FVector3f::DotProduct(Direction, Q) * InvDet;
+                if (V < 0.0f || U + V > 1.0f)
+                {
+                    continue;
+                }
+
+                const float Distance = FVector3f::DotProduct(Triangle.Edge2, Q) * InvDet;
+                if (Distance > AcousticBVH::RayEpsilon && Distance < BestDistance)
+                {
+                    BestDistance = Distance;
+                    BestTriangle = Index;
+                }
+            }
+        }
+        else
+        {
+            const FNode& Left = Nodes[Node.LeftOrFirst];
+            const FNode& Right = Nodes[Node.LeftOrFirst + 1];
+
+            float LeftDistance = AcousticBVH::RayBoxDistance(Left.BoundsMin, Left.BoundsMax, Origin, InvDirection, BestDistance);
+            float RightDistance = AcousticBVH::RayBoxDistance(Right.BoundsMin, Right.BoundsMax, Origin, InvDirection, BestDistance);
+            int32 Near = Node.LeftOrFirst;
+            int32 Far = Node.LeftOrFirst + 1;
+            if (RightDistance < LeftDistance)
+            {
+                Swap(LeftDistance, RightDistance);
+                Swap(Near, Far);
+            }
+
+            if (LeftDistance != MAX_flt)
+            {
+                if (RightDistance != MAX_flt)
+                {
+                    Stack[StackSize++] = TPair<int32, float>(Far, RightDistance);
+                }
+                NodeIndex = Near;
+                continue;
+            }
+        }
+
+        // Pop the next far child still closer than the best hit
+        bool bFoundNode = false;
+        while (StackSize > 0)
+        {
+            const TPair<int32, float>& Entry = Stack[--StackSize];
+            if (Entry.Value < BestDistance)
+            {
+                NodeIndex = Entry.Key;
+                bFoundNode = true;
+                break;
+            }
+        }
+
+        if (!bFoundNode)
+        {
+            break;
+        }
+    }
+
+    if (BestTriangle != INDEX_NONE)
+    {
+        Hit.Distance = BestDistance;
+        Hit.Triangle = PrimitiveIds[BestTriangle];
+    }
+    return Hit;
+}
+
+void FAcousticBVH::Traverse(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance,
+    TFunctionRef<float(int32 Primitive, float MaxDistance)> Visit) const
+{
+    if (Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    const FVector3f InvDirection(
+        AcousticBVH::SafeInverse(Direction.X),
+        AcousticBVH::SafeInverse(Direction.Y),
+        AcousticBVH::SafeInverse(Direction.Z));
+
+    float BestDistance = MaxDistance;
+    TPair<int32, float> Stack[AcousticBVH::MaxDepth + 2];
+    int32 StackSize = 0;
+
+    const float RootDistance = AcousticBVH::RayBoxDistance(Nodes[0].BoundsMin, Nodes[0].BoundsMax, Origin, InvDirection, BestDistance);
+    if (RootDistance != MAX_flt)
+    {
+        Stack[StackSize++] = TPair<int32, float>(0, RootDistance);
+    }
+
+    while (StackSize > 0)
+    {
+        const TPair<int32, float> Entry = Stack[--StackSize];
+        if (Entry.Value >= BestDistance)
+        {
+            continue;
+        }
+
+        const FNode& Node = Nodes[Entry.Key];
+        if (Node.IsLeaf())
+        {
+            for (int32 Index = Node.LeftOrFirst; Index < Node.LeftOrFirst + Node.Count; ++Index)
+            {
+                BestDistance = Visit(PrimitiveIds[Index], BestDistance);
+            }
+            continue;
+        }
+
+        const FNode& Left = Nodes[Node.LeftOrFirst];
+        const FNode& Right = Nodes[Node.LeftOrFirst + 1];
+        const float LeftDistance = AcousticBVH::RayBoxDistance(Left.BoundsMin, Left.BoundsMax, Origin, InvDirection, BestDistance);
+        const float RightDistance = AcousticBVH::RayBoxDistance(Right.BoundsMin, Right.BoundsMax, Origin, InvDirection, BestDistance);
+
+        // Push the far child first so the near one is visited next
+        const bool bLeftNear = LeftDistance <= RightDistance;
+        const TPair<int32, float> Near(bLeftNear ? Node.LeftOrFirst : Node.LeftOrFirst + 1, bLeftNear ? LeftDistance : RightDistance);
+        const TPair<int32, float> Far(bLeftNear ? Node.LeftOrFirst + 1 : Node.LeftOrFirst, bLeftNear ? RightDistance : LeftDistance);
+        if (Far.Value != MAX_flt)
+        {
+            Stack[StackSize++] = Far;
+        }
+        if (Near.Value != MAX_flt)
+        {
+            Stack[StackSize++] = Near;
+        }
+    }
+}
+
+// ============================================================================
+// RAY PACKETS
+// ============================================================================
+
+void FAcousticBVH::IntersectPacket(const FAcousticRayPacket& Packet, FAcousticBVHHit OutHits[FAcousticRayPacket::Width]) const
+{
+    static_assert(FAcousticRayPacket::Width == 4, "Packet traversal is written for VectorRegister4Float");
+
+    for (int32 Lane = 0; Lane < FAcousticRayPacket::Width; ++Lane)
+    {
+        OutHits[Lane] = FAcousticBVHHit();
+    }
+
+    if (Nodes.Num() == 0 || Packet.NumRays <= 0)
+    {
+        return;
+    }
+
+    float MaxDistances[FAcousticRayPacket::Width];
+    const AcousticBVH::FPacketLanes Rays(Packet, MaxDistances);
+    VectorRegister4Float TMax = VectorLoad(MaxDistances);
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+    const VectorRegister4Float RayEpsilon = VectorSetFloat1(AcousticBVH::RayEpsilon);
+    const VectorRegister4Float DetEpsilon = VectorSetFloat1(AcousticBVH::DeterminantEpsilon);
+
+    int32 HitTriangles[FAcousticRayPacket::Width] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+
+    int32 Stack[AcousticBVH::MaxDepth + 2];
+    int32 StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const FNode& Node = Nodes[Stack[--StackSize]];
+        if (Rays.TestBox(Node.BoundsMin, Node.BoundsMax, TMax) == 0)
+        {
+            continue;
+        }
+
+        if (!Node.IsLeaf())
+        {
+            // Visit the child nearer along the first ray's direction first
+            const FNode& Left = Nodes[Node.LeftOrFirst];
+            const FNode& Right = Nodes[Node.LeftOrFirst + 1];
+            const FVector3f Separation = (Right.BoundsMin + Right.BoundsMax) - (Left.BoundsMin + Left.BoundsMax);
+            const bool bLeftFirst = FVector3f::DotProduct(Separation, Packet.Directions[0]) >= 0.0f;
+
+            Stack[StackSize++] = bLeftFirst ? Node.LeftOrFirst + 1 : Node.LeftOrFirst;
+            Stack[StackSize++] = bLeftFirst ? Node.LeftOrFirst : Node.LeftOrFirst + 1;
+            continue;
+        }
+
+        for (int32 Index = Node.LeftOrFirst; Index < Node.LeftOrFirst + Node.Count; ++Index)
+        {
+            // Moller-Trumbore against all four rays
+            const FTriangle& Triangle = Triangles[Index];
+            const VectorRegister4Float E1X = VectorSetFloat1(Triangle.Edge1.X);
+            const VectorRegister4Float E1Y = VectorSetFloat1(Triangle.Edge1.Y);
+            const VectorRegister4Float E1Z = VectorSetFloat1(Triangle.Edge1.Z);
+            const VectorRegister4Float E2X = VectorSetFloat1(Triangle.Edge2.X);
+            const VectorRegister4Float E2Y = VectorSetFloat1(Triangle.Edge2.Y);
+            const VectorRegister4Float E2Z = VectorSetFloat1(Triangle.Edge2.Z);
+
+            // P = D x E2
+            const VectorRegister4Float PX = VectorNegateMultiplyAdd(Rays.DZ, E2Y, VectorMultiply(Rays.DY, E2Z));
+            const VectorRegister4Float PY = VectorNegateMultiplyAdd(Rays.DX, E2Z, VectorMultiply(Rays.DZ, E2X));
+            const VectorRegister4Float PZ = VectorNegateMultiplyAdd(Rays.DY, E2X, VectorMultiply(Rays.DX, E2Y));
+
+            const VectorRegister4Float Det = VectorMultiplyAdd(E1X, PX, VectorMultiplyAdd(E1Y, PY, VectorMultiply(E1Z, PZ)));
+            const VectorRegister4Float InvDet = VectorDivide(One, Det);
+
+            const VectorRegister4Float TX = VectorSubtract(Rays.OX, VectorSetFloat1(Triangle.V0.X));
+            const VectorRegister4Float TY = VectorSubtract(Rays.OY, VectorSetFloat1(Triangle.V0.Y));
+            const VectorRegister4Float TZ = VectorSubtract(Rays.OZ, VectorSetFloat1(Triangle.V0.Z));
+
+            const VectorRegister4Float U = VectorMultiply(
+                VectorMultiplyAdd(TX, PX, VectorMultiplyAdd(TY, PY, VectorMultiply(TZ, PZ))), InvDet);
+
+            // Q = T x E1
+            const VectorRegister4Float QX = VectorNegateMultiplyAdd(TZ, E1Y, VectorMultiply(TY, E1Z));
+            const VectorRegister4Float QY = VectorNegateMultiplyAdd(TX, E1Z, VectorMultiply(TZ, E1X));
+            const VectorRegister4Float QZ = VectorNegateMultiplyAdd(TY, E1X, VectorMultiply(TX, E1Y));
+
+            const VectorRegister4Float V = VectorMultiply(
+                VectorMultiplyAdd(Rays.DX, QX, VectorMultiplyAdd(Rays.DY, QY, VectorMultiply(Rays.DZ, QZ))), InvDet);
+            const VectorRegister4Float Distance = VectorMultiply(
+                VectorMultiplyAdd(E2X, QX, VectorMultiplyAdd(E2Y, QY, VectorMultiply(E2Z, QZ))), InvDet);
+
+            VectorRegister4Float Mask = VectorCompareGT(VectorAbs(Det), DetEpsilon);
+            Mask = VectorBitwiseAnd(Mask, VectorCompareGE(U, Zero));
+            Mask = VectorBitwiseAnd(Mask, VectorCompareGE(V, Zero));
+            Mask = VectorBitwiseAnd(Mask, VectorCompareLE(VectorAdd(U, V), One));
+            Mask = VectorBitwiseAnd(Mask, VectorCompareGT(Distance, RayEpsilon));
+            Mask = VectorBitwiseAnd(Mask, VectorCompareLT(Distance, TMax));
+
+            const int32 HitMask = VectorMaskBits(Mask);
+            if (HitMask == 0)
+            {
+                continue;
+            }
+
+            TMax = VectorSelect(Mask, Distance, TMax);
+            for (int32 Lane = 0; Lane < FAcousticRayPacket::Width; ++Lane)
+            {
+                if (HitMask & (1 << Lane))
+                {
+                    HitTriangles[Lane] = Index;
+                }
+            }
+        }
+    }
+
+    float HitDistances[FAcousticRayPacket::Width];
+    VectorStore(TMax, HitDistances);
+
+    for (int32 Lane = 0; Lane < Packet.NumRays && Lane < FAcousticRayPacket::Width; ++Lane)
+    {
+        if (HitTriangles[Lane] != INDEX_NONE)
+        {
+            OutHits[Lane].Distance = HitDistances[Lane];
+            OutHits[Lane].Triangle = PrimitiveIds[HitTriangles[Lane]];
+        }
+    }
+}
+
+void FAcousticBVH::TraversePacket(const FAcousticRayPacket& Packet,
+    TFunctionRef<void(int32 Primitive, int32 LaneMask, float MaxDistances[FAcousticRayPacket::Width])> Visit) const
+{
+    if (Nodes.Num() == 0 || Packet.NumRays <= 0)
+    {
+        return;
+    }
+
+    float MaxDistances[FAcousticRayPacket::Width];
+    const AcousticBVH::FPacketLanes Rays(Packet, MaxDistances);
+    VectorRegister4Float TMax = VectorLoad(MaxDistances);
+
+    int32 Stack[AcousticBVH::MaxDepth + 2];
+    int32 StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const FNode& Node = Nodes[Stack[--StackSize]];
+        const int32 LaneMask = Rays.TestBox(Node.BoundsMin, Node.BoundsMax, TMax);
+        if (LaneMask == 0)
+        {
+            continue;
+        }
+
+        if (!Node.IsLeaf())
+        {
+            const FNode& Left = Nodes[Node.LeftOrFirst];
+            const FNode& Right = Nodes[Node.LeftOrFirst + 1];
+            const FVector3f Separation = (Right.BoundsMin + Right.BoundsMax) - (Left.BoundsMin + Left.BoundsMax);
+            const bool bLeftFirst = FVector3f::DotProduct(Separation, Packet.Directions[0]) >= 0.0f;
+
+            Stack[StackSize++] = bLeftFirst ? Node.LeftOrFirst + 1 : Node.LeftOrFirst;
+            Stack[StackSize++] = bLeftFirst ? Node.LeftOrFirst : Node.LeftOrFirst + 1;
+            continue;
+        }
+
+        for (int32 Index = Node.LeftOrFirst; Index < Node.LeftOrFirst + Node.Count; ++Index)
+        {
+            Visit(PrimitiveIds[Index], LaneMask, MaxDistances);
+        }
+
+        // Visitors shorten lanes that hit something
+        TMax = VectorLoad(MaxDistances);
+    }
+}
@@ -0,0 +1,281 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticBakedData.h"
+#include "AcousticEngineSubsystem.h"
+#include "AcousticEngineModule.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/World.h"
+
+// ============================================================================
+// BAKED DATA - UOBJECT
+// ============================================================================
+
+void UAcousticBakedData::Serialize(FArchive& Ar)
+{
+    Super::Serialize(Ar);
+
+    if (Ar.IsSaving())
+    {
+        // Keep the entry table out of the export so cooked builds can map it
+        OcclusionBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload | BULKDATA_MemoryMappedPayload);
+    }
+
+    OcclusionBulkData.Serialize(Ar, this);
+}
+
+void UAcousticBakedData::PostLoad()
+{
+    Super::PostLoad();
+
+    if (Version != CurrentVersion)
+    {
+        UE_LOG(LogAcousticEngine, Warning, TEXT("Baked acoustic data '%s' is version %d (expected %d) - rebake required"),
+            *GetName(), Version, CurrentVersion);
+        return;
+    }
+
+    MapOcclusionEntries();
+}
+
+void UAcousticBakedData::BeginDestroy()
+{
+    UnmapOcclusionEntries();
+    Super::BeginDestroy();
+}
+
+void UAcousticBakedData::MapOcclusionEntries()
+{
+    UnmapOcclusionEntries();
+
+    const int64 Size = OcclusionBulkData.GetBulkDataSize();
+    if (Size <= 0)
+    {
+        return;
+    }
+
+    // Held read-only for the lifetime of the asset; lookups never lock
+    OcclusionEntries = static_cast<const uint32*>(OcclusionBulkData.LockReadOnly());
+    NumOcclusionEntries = OcclusionEntries ? static_cast<int32>(Size / sizeof(uint32)) : 0;
+}
+
+void UAcousticBakedData::UnmapOcclusionEntries()
+{
+    if (OcclusionEntries)
+    {
+        OcclusionBulkData.Unlock();
+        OcclusionEntries = nullptr;
+        NumOcclusionEntries = 0;
+    }
+}
+
+#if WITH_EDITOR
+void UAcousticBakedData::SetOcclusionEntries(const TArray<uint32>& Entries)
+{
+    UnmapOcclusionEntries();
+
+    OcclusionBulkData.Lock(LOCK_READ_WRITE);
+    void* Dest = OcclusionBulkData.Realloc(Entries.Num() * sizeof(uint32));
+    if (Entries.Num() > 0)
+    {
+        FMemory::Memcpy(Dest, Entries.GetData(), Entries.Num() * sizeof(uint32));
+    }
+    OcclusionBulkData.Unlock();
+
+    MapOcclusionEntries();
+}
+#endif
+
+// ============================================================================
+// BAKED DATA - QUERIES
+// ============================================================================
+
+bool UAcousticBakedData::GetCellCoord(const FVector& Location, FIntVector& OutCoord) const
+{
+    const FVector Local = (Location - GridOrigin) / CellSize;
+    OutCoord = FIntVector(
+        FMath::FloorToInt(Local.X),
+        FMath::FloorToInt(Local.Y),
+        FMath::FloorToInt(Local.Z)
+    );
+
+    return OutCoord.X >= 0 && OutCoord.X < GridDims.X
+        && OutCoord.Y >= 0 && OutCoord.Y < GridDims.Y
+        && OutCoord.Z >= 0 && OutCoord.Z < GridDims.Z;
+}
+
+int32 UAcousticBakedData::FindOpenCell(const FVector& Location) const
+{
+    FIntVector Coord;
+    if (!GetCellCoord(Location, Coord))
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 CellIndex = Coord.X + Coord.Y * GridDims.X + Coord.Z * GridDims.X * GridDims.Y;
+    return CellFlags.IsValidIndex(CellIndex) && (CellFlags[CellIndex] & CellFlag_Open) ? CellIndex : INDEX_NONE;
+}
+
+FVector UAcousticBakedData::GetCellCenter(int32 CellIndex) const
+{
+    const int32 SliceSize = GridDims.X * GridDims.Y;
+    const int32 Z = CellIndex / SliceSize;
+    const int32 Y = (CellIndex - Z * SliceSize) / GridDims.X;
+    const int32 X = CellIndex - Z * SliceSize - Y * GridDims.X;
+
+    return GridOrigin + (FVector(X, Y, Z) + 0.5) * CellSize;
+}
+
+bool UAcousticBakedData::LookupOcclusion(const FVector& From, const FVector& To, bool& bOutOccluded, uint8& OutSurfaceType) const
+{
+    bOutOccluded = false;
+    OutSurfaceType = 0;
+
+    if (!IsValid())
+    {
+        return false;
+    }
+
+    const int32 CellA = FindOpenCell(From);
+    const int32 CellB = FindOpenCell(To);
+    if (CellA == INDEX_NONE || CellB == INDEX_NONE)
+    {
+        return false;
+    }
+
+    if (CellA == CellB)
+    {
+        return true;
+    }
+
+    // Pairs beyond the bake radius were never traced
+    if (FVector::DistSquared(GetCellCenter(CellA), GetCellCenter(CellB)) > FMath::Square(MaxBakeDistance))
+    {
+        return false;
+    }
+
+    // Each pair is stored once, under the lower cell
+    const int32 Lo = FMath::Min(CellA, CellB);
+    const uint32 Hi = static_cast<uint32>(FMath::Max(CellA, CellB));
+
+    const int32 Begin = static_cast<int32>(OcclusionOffsets[Lo]);
+    const int32 End = FMath::Min(static_cast<int32>(OcclusionOffsets[Lo + 1]), NumOcclusionEntries);
+    if (Begin >= End)
+    {
+        return true;
+    }
+
+    const TConstArrayView<uint32> CellEntries(OcclusionEntries + Begin, End - Begin);
+    const int32 Found = Algo::LowerBoundBy(CellEntries, Hi, [](uint32 Entry) { return Entry >> EntryCellShift; });
+    if (Found < CellEntries.Num() && (CellEntries[Found] >> EntryCellShift) == Hi)
+    {
+        bOutOccluded = true;
+        OutSurfaceType = static_cast<uint8>(CellEntries[Found] & 0xFF);
+    }
+
+    return true;
+}
+
+int32 UAcousticBakedData::GatherProbeWeights(const FVector& Location, int32 OutCells[8], float OutWeights[8]) const
+{
+    if (!IsValid() || Probes.Num() != GetNumCells() || ProbeTaps.Num() != GetNumCells() * MaxProbeTaps)
+    {
+        return 0;
+    }
+
+    FIntVector Coord;
+    if (!GetCellCoord(Location, Coord))
+    {
+        return 0;
+    }
+
+    // Probes sit at cell centers - interpolate on the lattice of centers
+    const FVector Local = (Location - GridOrigin) / CellSize - FVector(0.5);
+    const FIntVector Base(FMath::FloorToInt(Local.X), FMath::FloorToInt(Local.Y), FMath::FloorToInt(Local.Z));
+    const FVector Frac = Local - FVector(Base);
+
+    int32 NumProbes = 0;
+    float TotalWeight = 0.0f;
+
+    for (int32 Corner = 0; Corner < 8; Corner++)
+    {
+        const FIntVector Offset(Corner & 1, (Corner >> 1) & 1, (Corner >> 2) & 1);
+        const FIntVector C = Base + Offset;
+        if (C.X < 0 || C.X >= GridDims.X || C.Y < 0 || C.Y >= GridDims.Y || C.Z < 0 || C.Z >= GridDims.Z)
+        {
+            continue;
+        }
+
+        const int32 CellIndex = C.X + C.Y * GridDims.X + C.Z * GridDims.X * GridDims.Y;
+        if (!(CellFlags[CellIndex] & CellFlag_Probe))
+        {
+            continue;
+        }
+
+        const float Weight =
+            (Offset.X ? Frac.X : 1.0 - Frac.X) *
+            (Offset.Y ? Frac.Y : 1.0 - Frac.Y) *
+            (Offset.Z ? Frac.Z : 1.0 - Frac.Z);
+        if (Weight <= 0.0f)
+        {
+            continue;
+        }
+
+        OutCells[NumProbes] = CellIndex;
+        OutWeights[NumProbes] = Weight;
+        TotalWeight += Weight;
+        NumProbes++;
+    }
+
+    if (TotalWeight <= KINDA_SMALL_NUMBER)
+    {
+        return 0;
+    }
+
+    for (int32 i = 0; i < NumProbes; i++)
+    {
+        OutWeights[i] /= TotalWeight;
+    }
+    return NumProbes;
+}
+
+// ============================================================================
+// BAKE VOLUME
+// ============================================================================
+
+AAcousticBakeVolume::AAcousticBakeVolume()
+{
+    PrimaryActorTick.bCanEverTick = false;
+}
+
+void AAcousticBakeVolume::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (!BakedData || !BakedData->IsValid())
+    {
+        UE_LOG(LogAcousticEngine, Warning, TEXT("Acoustic Bake Volume '%s' has no valid baked data - live traces only"),
+            *GetName());
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UAcousticEngineSubsystem* Subsystem = World->GetSubsystem<UAcousticEngineSubsystem>())
+        {
+            Subsystem->RegisterBakedData(BakedData);
+        }
+    }
+}
+
+void AAcousticBakeVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UAcousticEngineSubsystem* Subsystem = World->GetSubsystem<UAcousticEngineSubsystem>())
+        {
+            Subsystem->UnregisterBakedData(BakedData);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
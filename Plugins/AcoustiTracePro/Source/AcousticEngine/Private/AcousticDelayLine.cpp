@@ -0,0 +1,87 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticDelayLine.h"
+
+void FAcousticDelayLine::Init(int32 MinCapacity)
+{
+    const uint32 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(MinCapacity, 1)));
+    Buffer.SetNumUninitialized(Capacity);
+    Mask = Capacity - 1;
+    Reset();
+}
+
+void FAcousticDelayLine::Reset()
+{
+    FMemory::Memzero(Buffer.GetData(), Buffer.Num() * sizeof(float));
+    WriteIndex = 0;
+}
+
+void FAcousticDelayLine::WriteBlock(const float* Input, int32 NumFrames)
+{
+    checkSlow(NumFrames <= Buffer.Num());
+
+    const int32 FirstSpan = FMath::Min(NumFrames, Buffer.Num() - static_cast<int32>(WriteIndex));
+    FMemory::Memcpy(Buffer.GetData() + WriteIndex, Input, FirstSpan * sizeof(float));
+    FMemory::Memcpy(Buffer.GetData(), Input + FirstSpan, (NumFrames - FirstSpan) * sizeof(float));
+    WriteIndex = (WriteIndex + NumFrames) & Mask;
+}
+
+void FAcousticDelayLine::ReadBlock(int32 DelaySamples, float* Output, int32 NumFrames) const
+{
+    checkSlow(NumFrames <= Buffer.Num());
+
+    const uint32 Start = (WriteIndex - static_cast<uint32>(DelaySamples)) & Mask;
+    const int32 FirstSpan = FMath::Min(NumFrames, Buffer.Num() - static_cast<int32>(Start));
+    FMemory::Memcpy(Output, Buffer.GetData() + Start, FirstSpan * sizeof(float));
+    FMemory::Memcpy(Output + FirstSpan, Buffer.GetData(), (NumFrames - FirstSpan) * sizeof(float));
+}
+
+void FAcousticDelayLine::ReadBlockFractional(float DelaySamples, float* Output, int32 NumFrames) const
+{
+    const int32 WholeSamples = FMath::FloorToInt(DelaySamples);
+    const float Frac = DelaySamples - WholeSamples;
+    if (Frac == 0.0f)
+    {
+        ReadBlock(WholeSamples, Output, NumFrames);
+        return;
+    }
+
+    // Each output blends a sample with the one written just before it, one position back
+    const float* Data = Buffer.GetData();
+    const uint32 Start = (WriteIndex - static_cast<uint32>(WholeSamples)) & Mask;
+    const VectorRegister4Float FracVector = VectorSetFloat1(Frac);
+
+    int32 Frame = 0;
+    while (Frame < NumFrames)
+    {
+        const uint32 Position = (Start + Frame) & Mask;
+
+        // The older neighbour of position 0 is at the end of the buffer
+        if (Position == 0)
+        {
+            Output[Frame] = Data[0] + (Data[Mask] - Data[0]) * Frac;
+            Frame++;
+            continue;
+        }
+
+        // Contiguous run up to the wrap
+        const int32 Span = FMath::Min(NumFrames - Frame, Buffer.Num() - static_cast<int32>(Position));
+        const float* Current = Data + Position;
+        const float* Older = Current - 1;
+        float* Out = Output + Frame;
+
+        int32 Index = 0;
+        for (; Index + 4 <= Span; Index += 4)
+        {
+            const VectorRegister4Float CurrentVector = VectorLoad(Current + Index);
+            const VectorRegister4Float OlderVector = VectorLoad(Older + Index);
+            VectorStore(VectorMultiplyAdd(VectorSubtract(OlderVector, CurrentVector), FracVector, CurrentVector), Out + Index);
+        }
+        for (; Index < Span; Index++)
+        {
+            Out[Index] = Current[Index] + (Older[Index] - Current[Index]) * Frac;
+        }
+
+        Frame += Span;
+    }
+}
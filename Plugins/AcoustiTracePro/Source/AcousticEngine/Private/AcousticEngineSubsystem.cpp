@@ -3,6 +3,7 @@
 #include "AcousticEngineSubsystem.h"
 #include "AcousticSourceComponent.h"
 #include "AcousticZoneVolume.h"
+#include "AcousticBakedData.h"
 #include "AcousticSettings.h"
 #include "AcousticEngineModule.h"
 #include "Engine/World.h"
@@ -10,8 +11,17 @@
 #include "Kismet/GameplayStatics.h"
 #include "CollisionQueryParams.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "Components/PrimitiveComponent.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectGlobals.h"
+#include "Engine/Level.h"
 #include "DrawDebugHelpers.h"
 
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Worst Occlusion Staleness Basic (ms)"), STAT_AcousticStalenessBasic, STATGROUP_AcousticEngine);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Worst Occlusion Staleness Advanced (ms)"), STAT_AcousticStalenessAdvanced, STATGROUP_AcousticEngine);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Worst Occlusion Staleness Hero (ms)"), STAT_AcousticStalenessHero, STATGROUP_AcousticEngine);
+
 // ============================================================================
 // CONSTANTS
 // ============================================================================
@@ -32,6 +42,47 @@ namespace AcousticConstants
 
     // Priority multipliers by importance
     constexpr float ImportanceMultipliers[] = { 0.25f, 1.0f, 2.0f, 10.0f };
+
+    // Reflection path rays start this far off the surface they leave (cm)
+    constexpr float PathSurfaceOffset = 1.0f;
+
+    // Cached paths tested for visibility per source, as a multiple of the tap count
+    constexpr int32 PathCandidatesPerTap = 2;
+
+    // Probe hits closer than this in normal (dot) and offset (cm) belong to one reflector plane
+    constexpr float ReflectorPlaneNormalDot = 0.98f;
+    constexpr float ReflectorPlaneTolerance = 25.0f;
+
+    // Reflector planes kept per probe, and probe hits needed to keep one
+    constexpr int32 MaxReflectorPlanes = 6;
+    constexpr int32 MinReflectorPlaneHits = 2;
+
+    // Highest image-source order (later orders are left to the path tracer)
+    constexpr int32 MaxImageOrder = 2;
+
+    // Taps closer than this are treated as the same path when merging (ms)
+    constexpr float MinTapSeparationMs = 0.5f;
+
+    /**
+     * Advance a per-source deadline by one interval. A source that fell more
+     * than an interval behind is re-staggered by its phase instead of
+     * catching up with back-to-back updates.
+     */
+    static double AdvanceDeadline(double Deadline, double Interval, float Phase, double CurrentTime)
+    {
+        const double Next = Deadline + Interval;
+        return Next > CurrentTime ? Next : CurrentTime + Interval * Phase;
+    }
+
+    /**
+     * Eyring reverb time from a mean free path (m) and average absorption.
+     * With V/S = MFP/4 the usual 0.161 V / (-S ln(1 - a)) needs no room volume.
+     */
+    static float EstimateRT60(float MeanFreePath, float Absorption)
+    {
+        const float ClampedAbsorption = FMath::Clamp(Absorption, 0.01f, 0.99f);
+        return 0.04025f * MeanFreePath / -FMath::Loge(1.0f - ClampedAbsorption);
+    }
 }
 
 // ============================================================================
@@ -62,6 +113,14 @@ void UAcousticEngineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
     // Initialize ray budget
     CurrentBudget.TotalRaysBudget = Settings ? Settings->MaxRaysPerFrame : 200;
+    PublishedBudget = CurrentBudget;
+
+    // Compile the material table from the active profile
+    ActiveProfile = Settings ? Settings->AcousticProfile.LoadSynchronous() : nullptr;
+    BuildMaterialTable();
+
+    // A worker update must not overlap garbage collection
+    PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UAcousticEngineSubsystem::WaitForSimulation);
 
     bIsInitialized = true;
 }
@@ -70,11 +129,47 @@ void UAcousticEngineSubsystem::Deinitialize()
 {
     UE_LOG(LogAcousticEngine, Log, TEXT("AcousticEngineSubsystem deinitializing"));
 
+    // The worker update references this subsystem
+    WaitForSimulation();
+    bSimulationResultsPending = false;
+    PublishedParams.Empty();
+
     // Clear all registered sources
-    RegisteredSources.Empty();
+    Sources.Reset();
+    SourceGrid.Reset();
+    MovedSourceIds.Empty();
+    GatheredSourceIds.Empty();
+    ReflectionProbes.Empty();
+    NumPendingOcclusionTraces = 0;
     RegisteredZones.Empty();
+    ZoneIndex.Reset();
+    ListenerZones.Empty();
+    ListenerZonePresets.Empty();
+    ListenerProbeSamples.Empty();
     RegisteredPortals.Empty();
+    PortalGraph.Reset();
+    ChangedPortals.Empty();
+    ActiveBakedData.Empty();
+    GeometryScene.Reset();
+    bGeometrySceneDirty = false;
     ListenerDataArray.Empty();
+    MaterialTable.Empty();
+    NamedMaterialSlots.Empty();
+    PhysMatIndexCache.Empty();
+
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    LevelAddedHandle.Reset();
+    LevelRemovedHandle.Reset();
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    }
+    ActorSpawnedHandle.Reset();
+    PendingSceneActors.Empty();
+
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+    PreGarbageCollectHandle.Reset();
 
     // Remove tick delegate
     if (TickDelegateHandle.IsValid())
@@ -104,6 +199,16 @@ void UAcousticEngineSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 
     UE_LOG(LogAcousticEngine, Log, TEXT("AcousticEngineSubsystem - World Begin Play"));
 
+    // Static geometry of the persistent level, then of every level streamed in later
+    if (Settings && Settings->bUseAcousticGeometryScene)
+    {
+        RebuildGeometryScene();
+    }
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UAcousticEngineSubsystem::OnLevelsChanged);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UAcousticEngineSubsystem::OnLevelsChanged);
+    ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(this, &UAcousticEngineSubsystem::OnActorSpawned));
+
     // Register tick function
     TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(
         FTickerDelegate::CreateUObject(this, &UAcousticEngineSubsystem::TickSubsystem),
@@ -127,6 +232,16 @@ void UAcousticEngineSubsystem::Tick(float DeltaTime)
     // Update listener positions from player controllers
     UpdateListenersFromPlayers();
 
+    if (Settings->bUseAsyncSimulation)
+    {
+        // Debug drawing happens between consuming results and launching the next update
+        TickAsyncSimulation(DeltaTime);
+        return;
+    }
+
+    // Async simulation was just switched off
+    WaitForSimulation();
+
     // Process acoustic updates
     ProcessAcousticUpdate(DeltaTime);
 
@@ -148,59 +263,96 @@ int32 UAcousticEngineSubsystem::RegisterSource(UAcousticSourceComponent* Source)
         return -1;
     }
 
-    // Check if already registered
-    for (const auto& Pair : RegisteredSources)
+    // The registry belongs to the worker update while it runs
+    WaitForSimulation();
+
+    // Already registered - the component holds its own handle
+    const int32 ExistingDense = Sources.FindDense(Source->SourceId);
+    if (ExistingDense != INDEX_NONE && Sources.Components[ExistingDense].Get() == Source)
     {
-        if (Pair.Value.SourceComponent.Get() == Source)
-        {
-            return Pair.Key;
-        }
+        return Source->SourceId;
     }
 
-    // Create new entry
-    FAcousticSourceEntry Entry;
-    Entry.SourceComponent = Source;
-    Entry.SourceId = NextSourceId++;
-    Entry.CurrentParams.Reset();
-    Entry.PreviousParams.Reset();
-    Entry.EffectiveLOD = Source->AcousticLOD;
-    Entry.bIsAudible = true;
+    const int32 SourceId = Sources.Add(Source);
 
-    RegisteredSources.Add(Entry.SourceId, Entry);
+    // Enters the source grid with the next update
+    NotifySourceMoved(SourceId);
 
     UE_LOG(LogAcousticEngine, Verbose, TEXT("Registered acoustic source %d: %s"),
-        Entry.SourceId, *Source->GetOwner()->GetName());
+        SourceId, *Source->GetOwner()->GetName());
 
-    return Entry.SourceId;
+    return SourceId;
 }
 
 void UAcousticEngineSubsystem::UnregisterSource(int32 SourceId)
 {
-    if (RegisteredSources.Remove(SourceId) > 0)
+    WaitForSimulation();
+
+    const int32 DenseIndex = Sources.FindDense(SourceId);
+    if (DenseIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (Sources.ColdData[DenseIndex].PendingOcclusion.IssueFrame != 0)
     {
-        UE_LOG(LogAcousticEngine, Verbose, TEXT("Unregistered acoustic source %d"), SourceId);
+        NumPendingOcclusionTraces--;
     }
+
+    Sources.Remove(SourceId);
+    SourceGrid.Remove(SourceId);
+    UE_LOG(LogAcousticEngine, Verbose, TEXT("Unregistered acoustic source %d"), SourceId);
 }
 
 bool UAcousticEngineSubsystem::GetSourceParams(int32 SourceId, FAcousticSourceParams& OutParams) const
 {
-    if (const FAcousticSourceEntry* Entry = RegisteredSources.Find(SourceId))
+    const int32 DenseIndex = Sources.FindDense(SourceId);
+    if (DenseIndex == INDEX_NONE)
     {
-        OutParams = Entry->CurrentParams;
-        return true;
+        return false;
     }
-    return false;
+
+    // Dense order cannot change while an update runs - registration waits for it
+    OutParams = IsSimulationInFlight() ? PublishedParams[DenseIndex] : Sources.ColdData[DenseIndex].CurrentParams;
+    return true;
 }
 
 void UAcousticEngineSubsystem::ForceSourceUpdate(int32 SourceId)
 {
-    if (FAcousticSourceEntry* Entry = RegisteredSources.Find(SourceId))
+    WaitForSimulation();
+
+    const int32 DenseIndex = Sources.FindDense(SourceId);
+    if (DenseIndex != INDEX_NONE)
+    {
+        Sources.LastOcclusionUpdateTimes[DenseIndex] = 0.0;
+        Sources.LastReflectionUpdateTimes[DenseIndex] = 0.0;
+        Sources.NextOcclusionUpdateTimes[DenseIndex] = 0.0;
+        Sources.NextReflectionUpdateTimes[DenseIndex] = 0.0;
+
+        // Push the next result even if it matches what the component already has
+        Sources.ColdData[DenseIndex].AppliedParams.bIsValid = false;
+        Sources.OcclusionCacheValid[DenseIndex] = false;
+    }
+}
+
+void UAcousticEngineSubsystem::NotifySourceMoved(int32 SourceId)
+{
+    // Positions belong to the worker update while it runs - pick the move up when the next one begins.
+    // A component can report several transform updates per frame; queue it once.
+    const int32 DenseIndex = Sources.FindDense(SourceId);
+    if (DenseIndex != INDEX_NONE && !Sources.MovedFlags[DenseIndex])
     {
-        Entry->LastOcclusionUpdateTime = 0.0;
-        Entry->LastReflectionUpdateTime = 0.0;
+        Sources.MovedFlags[DenseIndex] = true;
+        MovedSourceIds.Add(SourceId);
     }
 }
 
+void UAcousticEngineSubsystem::InvalidateOcclusionInRadius(const FVector& Center, float Radius)
+{
+    // Applied when the next update begins, so this never waits for a worker update
+    PendingOcclusionInvalidations.Add(FSphere(Center, FMath::Max(Radius, 0.0f)));
+}
+
 // ============================================================================
 // LISTENER MANAGEMENT
 // ============================================================================
@@ -281,6 +433,8 @@ void UAcousticEngineSubsystem::RegisterZone(AAcousticZoneVolume* Zone)
     if (Zone && !RegisteredZones.Contains(Zone))
     {
         RegisteredZones.Add(Zone);
+        bZoneIndexDirty = true;
+        bPortalGraphDirty = true;
         UE_LOG(LogAcousticEngine, Verbose, TEXT("Registered acoustic zone: %s"), *Zone->ZoneName.ToString());
     }
 }
@@ -288,6 +442,8 @@ void UAcousticEngineSubsystem::RegisterZone(AAcousticZoneVolume* Zone)
 void UAcousticEngineSubsystem::UnregisterZone(AAcousticZoneVolume* Zone)
 {
     RegisteredZones.Remove(Zone);
+    bZoneIndexDirty = true;
+    bPortalGraphDirty = true;
 }
 
 void UAcousticEngineSubsystem::RegisterPortal(AAcousticPortalVolume* Portal)
@@ -295,6 +451,7 @@ void UAcousticEngineSubsystem::RegisterPortal(AAcousticPortalVolume* Portal)
     if (Portal && !RegisteredPortals.Contains(Portal))
     {
         RegisteredPortals.Add(Portal);
+        bPortalGraphDirty = true;
         UE_LOG(LogAcousticEngine, Verbose, TEXT("Registered acoustic portal: %s"), *Portal->PortalName.ToString());
     }
 }
@@ -302,10 +459,113 @@ void UAcousticEngineSubsystem::RegisterPortal(AAcousticPortalVolume* Portal)
 void UAcousticEngineSubsystem::UnregisterPortal(AAcousticPortalVolume* Portal)
 {
     RegisteredPortals.Remove(Portal);
+    bPortalGraphDirty = true;
+}
+
+void UAcousticEngineSubsystem::NotifyPortalChanged(AAcousticPortalVolume* Portal)
+{
+    if (!Portal)
+    {
+        return;
+    }
+
+    FVector Origin, Extent;
+    Portal->GetActorBounds(false, Origin, Extent);
+    InvalidateOcclusionInRadius(Origin, Extent.Size());
+
+    // The graph is read by the simulation - refresh it when the next update begins
+    ChangedPortals.AddUnique(Portal);
+}
+
+void UAcousticEngineSubsystem::RegisterBakedData(UAcousticBakedData* BakedData)
+{
+    if (!BakedData)
+    {
+        return;
+    }
+
+    // Lookups run inside the simulation update
+    WaitForSimulation();
+    ActiveBakedData.AddUnique(BakedData);
+
+    UE_LOG(LogAcousticEngine, Log, TEXT("Baked acoustic data '%s' registered (%d x %d x %d cells)"),
+        *BakedData->GetName(), BakedData->GridDims.X, BakedData->GridDims.Y, BakedData->GridDims.Z);
+}
+
+void UAcousticEngineSubsystem::UnregisterBakedData(UAcousticBakedData* BakedData)
+{
+    WaitForSimulation();
+    ActiveBakedData.Remove(BakedData);
+}
+
+// ============================================================================
+// GEOMETRY SCENE
+// ============================================================================
+
+void UAcousticEngineSubsystem::RebuildGeometryScene()
+{
+    // Worker updates trace the scene
+    WaitForSimulation();
+
+    GeometryScene.Build(GetWorld(), Settings->AudioOcclusionChannel, Settings->AcousticProxyLOD);
+    GeometryScene.ResolveMaterials([this](const UPhysicalMaterial* PhysMat) { return ResolveMaterialIndex(PhysMat); });
+    bGeometrySceneDirty = false;
+    PendingSceneActors.Reset();
+}
+
+void UAcousticEngineSubsystem::OnLevelsChanged(ULevel* Level, UWorld* InWorld)
+{
+    if (InWorld == GetWorld() && Settings && Settings->bUseAcousticGeometryScene)
+    {
+        bGeometrySceneDirty = true;
+    }
+}
+
+void UAcousticEngineSubsystem::OnActorSpawned(AActor* Actor)
+{
+    if (Settings && Settings->bUseAcousticGeometryScene)
+    {
+        PendingSceneActors.Add(Actor);
+    }
+}
+
+void UAcousticEngineSubsystem::UpdateGeometryScene()
+{
+    // Level streaming is coalesced into one full rebuild
+    if (bGeometrySceneDirty)
+    {
+        PendingSceneActors.Reset();
+        RebuildGeometryScene();
+        return;
+    }
+
+    if (PendingSceneActors.Num() > 0)
+    {
+        for (const TWeakObjectPtr<AActor>& Actor : PendingSceneActors)
+        {
+            GeometryScene.AddActor(Actor.Get(), Settings->AudioOcclusionChannel, Settings->AcousticProxyLOD);
+        }
+        PendingSceneActors.Reset();
+        GeometryScene.ResolveMaterials([this](const UPhysicalMaterial* PhysMat) { return ResolveMaterialIndex(PhysMat); });
+    }
+
+    // Anything heard through or around a moved instance has to be re-traced
+    TArray<FBox, TInlineAllocator<16>> ChangedBounds;
+    GeometryScene.UpdateInstances(ChangedBounds);
+    for (const FBox& Bounds : ChangedBounds)
+    {
+        PendingOcclusionInvalidations.Add(FSphere(Bounds.GetCenter(), Bounds.GetExtent().Size()));
+    }
 }
 
 AAcousticZoneVolume* UAcousticEngineSubsystem::GetZoneAtLocation(const FVector& Location) const
 {
+    if (!bZoneIndexDirty)
+    {
+        return ZoneIndex.FindZone(Location);
+    }
+
+    // Grid not built yet this frame - fall back to a linear scan
     AAcousticZoneVolume* BestZone = nullptr;
     int32 BestPriority = INT_MIN;
 
@@ -326,12 +586,18 @@ AAcousticZoneVolume* UAcousticEngineSubsystem::GetZoneAtLocation(const FVector&
 
 FAcousticZonePreset UAcousticEngineSubsystem::GetCurrentZonePreset(int32 ListenerIndex) const
 {
+    // Resolved once per frame by RefreshListenerZoneCache
+    if (ListenerZoneCacheFrame == GFrameCounter && ListenerZonePresets.IsValidIndex(ListenerIndex))
+    {
+        return ListenerZonePresets[ListenerIndex];
+    }
+
     if (ListenerIndex >= 0 && ListenerIndex < ListenerDataArray.Num())
     {
         const FAcousticListenerData& Listener = ListenerDataArray[ListenerIndex];
         if (AAcousticZoneVolume* Zone = GetZoneAtLocation(Listener.Location))
         {
-            return Zone->GetZonePreset();
+            return Zone->GetCachedZonePreset();
         }
     }
 
@@ -355,9 +621,9 @@ void UAcousticEngineSubsystem::SetAudioOutputMode(EAudioOutputMode NewMode)
             NewMode == EAudioOutputMode::Headphones ? TEXT("Headphones") : TEXT("Speakers"));
 
         // Notify all sources of mode change
-        for (auto& Pair : RegisteredSources)
+        for (const TWeakObjectPtr<UAcousticSourceComponent>& SourcePtr : Sources.Components)
         {
-            if (UAcousticSourceComponent* Source = Pair.Value.SourceComponent.Get())
+            if (UAcousticSourceComponent* Source = SourcePtr.Get())
             {
                 Source->ForceUpdate();
             }
@@ -371,29 +637,110 @@ void UAcousticEngineSubsystem::SetAudioOutputMode(EAudioOutputMode NewMode)
 
 FAcousticMaterial UAcousticEngineSubsystem::GetAcousticMaterial(UPhysicalMaterial* PhysMat) const
 {
-    if (PhysMat)
+    return GetMaterialByIndex(ResolveMaterialIndex(PhysMat));
+}
+
+void UAcousticEngineSubsystem::RegisterMaterialMapping(FName PhysMatName, const FAcousticMaterial& AcousticMat)
+{
+    // Worker updates read the table
+    WaitForSimulation();
+
+    MaterialMappings.Add(PhysMatName, AcousticMat);
+    BuildMaterialTable();
+}
+
+uint8 UAcousticEngineSubsystem::ResolveMaterialIndex(const UPhysicalMaterial* PhysMat) const
+{
+    if (!PhysMat)
+    {
+        return SurfaceType_Default;
+    }
+
+    // Resolved once per physical material
     {
-        FName PhysMatName = PhysMat->GetFName();
-        if (const FAcousticMaterial* Found = MaterialMappings.Find(PhysMatName))
+        FReadScopeLock ReadLock(MaterialCacheLock);
+        if (const uint8* Cached = PhysMatIndexCache.Find(PhysMat))
         {
-            return *Found;
+            return *Cached;
         }
     }
 
-    // Return default material
-    FAcousticMaterial Default;
-    Default.MaterialType = EAcousticMaterialType::Default;
-    Default.LowAbsorption = 0.1f;
-    Default.MidAbsorption = 0.2f;
-    Default.HighAbsorption = 0.3f;
-    Default.Transmission = 0.0f;
-    Default.Scattering = 0.1f;
-    return Default;
+    // A mapping for the physical material's own name wins, then its surface slot
+    uint8 MaterialIndex = SurfaceType_Default;
+    const int32 Surface = PhysMat->SurfaceType;
+    if (const uint8* Named = NamedMaterialSlots.Find(PhysMat->GetFName()))
+    {
+        MaterialIndex = *Named;
+    }
+    else if (MappedSurfaces.IsValidIndex(Surface) && MappedSurfaces[Surface])
+    {
+        MaterialIndex = static_cast<uint8>(Surface);
+    }
+
+    FWriteScopeLock WriteLock(MaterialCacheLock);
+    PhysMatIndexCache.Add(PhysMat, MaterialIndex);
+    return MaterialIndex;
 }
 
-void UAcousticEngineSubsystem::RegisterMaterialMapping(FName PhysMatName, const FAcousticMaterial& AcousticMat)
+void UAcousticEngineSubsystem::BuildMaterialTable()
 {
-    MaterialMappings.Add(PhysMatName, AcousticMat);
+    DefaultMaterial = AcousticDefaults::GetDefaultMaterial(EAcousticMaterialType::Default);
+    MaterialTable.Init(DefaultMaterial, SurfaceType_Max);
+    MappedSurfaces.Init(false, SurfaceType_Max);
+    NamedMaterialSlots.Reset();
+    PhysMatIndexCache.Reset();
+
+    // Profile mappings first, runtime registrations override
+    TMap<FName, FAcousticMaterial> Mappings;
+    if (ActiveProfile)
+    {
+        Mappings.Append(ActiveProfile->MaterialMappings);
+    }
+    Mappings.Append(MaterialMappings);
+
+    // Surface slots: an explicit mapping for the surface name, else a default
+    // preset when the surface is named after a material type ("Concrete", ...)
+    const UEnum* MaterialTypeEnum = StaticEnum<EAcousticMaterialType>();
+    for (const FPhysicalSurfaceName& Surface : UPhysicsSettings::Get()->PhysicalSurfaces)
+    {
+        const int32 Slot = Surface.Type;
+        if (!MaterialTable.IsValidIndex(Slot))
+        {
+            continue;
+        }
+
+        if (const FAcousticMaterial* Mapped = Mappings.Find(Surface.Name))
+        {
+            MaterialTable[Slot] = *Mapped;
+            MappedSurfaces[Slot] = true;
+            continue;
+        }
+
+        const int64 TypeValue = MaterialTypeEnum->GetValueByNameString(Surface.Name.ToString());
+        if (TypeValue != INDEX_NONE && TypeValue != static_cast<int64>(EAcousticMaterialType::Custom))
+        {
+            MaterialTable[Slot] = AcousticDefaults::GetDefaultMaterial(static_cast<EAcousticMaterialType>(TypeValue));
+            MappedSurfaces[Slot] = true;
+        }
+    }
+
+    // Name mappings get their own slots, checked before the surface slot
+    for (const TPair<FName, FAcousticMaterial>& Pair : Mappings)
+    {
+        if (MaterialTable.Num() > MAX_uint8)
+        {
+            UE_LOG(LogAcousticEngine, Warning, TEXT("Acoustic material table full, ignoring mapping '%s'"),
+                *Pair.Key.ToString());
+            continue;
+        }
+
+        NamedMaterialSlots.Add(Pair.Key, static_cast<uint8>(MaterialTable.Add(Pair.Value)));
+    }
+
+    UE_LOG(LogAcousticEngine, Verbose, TEXT("Compiled acoustic material table: %d slots"), MaterialTable.Num());
+
+    // Scene triangles carry proxy material ids resolved against the table
+    GeometryScene.ResolveMaterials([this](const UPhysicalMaterial* PhysMat) { return ResolveMaterialIndex(PhysMat); });
 }
 
 // ============================================================================
@@ -408,36 +755,23 @@ float UAcousticEngineSubsystem::TraceOcclusion(const FVector& Start, const FVect
         return 0.0f;
     }
 
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.bTraceComplex = Settings->bUseComplexCollision;
-    QueryParams.bReturnPhysicalMaterial = true;
+    if (ShouldUseGeometryScene())
+    {
+        return GeometryScene.TraceSingle(Start, End, OutHit) ? ComputeOcclusionFactor(OutHit) : 0.0f;
+    }
 
+    FHitResult HitResult;
     bool bHit = World->LineTraceSingleByChannel(
         HitResult,
         Start,
         End,
         Settings->AudioOcclusionChannel,
-        QueryParams
+        MakeTraceQueryParams()
     );
 
     if (bHit)
     {
-        OutHit.bIsValidHit = true;
-        OutHit.HitLocation = HitResult.ImpactPoint;
-        OutHit.HitNormal = HitResult.ImpactNormal;
-        OutHit.Distance = HitResult.Distance;
-
-        if (HitResult.PhysMaterial.IsValid())
-        {
-            OutHit.PhysicalMaterialName = HitResult.PhysMaterial->GetFName();
-            OutHit.Material = GetAcousticMaterial(HitResult.PhysMaterial.Get());
-        }
-        else
-        {
-            OutHit.Material = GetAcousticMaterial(nullptr);
-        }
-
+        FillRayHit(HitResult, OutHit);
         return ComputeOcclusionFactor(OutHit);
     }
 
@@ -460,9 +794,23 @@ void UAcousticEngineSubsystem::SampleReflections(const FVector& Origin, const FV
     TArray<FVector> Directions;
     GenerateHemisphereRays(Forward, NumRays, Directions);
 
-    FCollisionQueryParams QueryParams;
-    QueryParams.bTraceComplex = Settings->bUseComplexCollision;
-    QueryParams.bReturnPhysicalMaterial = true;
+    if (ShouldUseGeometryScene())
+    {
+        TArray<FAcousticRayHit> RayHits;
+        RayHits.SetNum(Directions.Num());
+        GeometryScene.TraceRays(Origin, Directions, Settings->MaxTraceDistance, RayHits);
+
+        for (const FAcousticRayHit& RayHit : RayHits)
+        {
+            if (RayHit.bIsValidHit)
+            {
+                OutHits.Add(RayHit);
+            }
+        }
+        return;
+    }
+
+    const FCollisionQueryParams QueryParams = MakeTraceQueryParams();
 
     for (const FVector& Direction : Directions)
     {
@@ -479,311 +827,1805 @@ void UAcousticEngineSubsystem::SampleReflections(const FVector& Origin, const FV
 
         if (bHit)
         {
-            FAcousticRayHit RayHit;
-            RayHit.bIsValidHit = true;
-            RayHit.HitLocation = HitResult.ImpactPoint;
-            RayHit.HitNormal = HitResult.ImpactNormal;
-            RayHit.Distance = HitResult.Distance;
-
-            if (HitResult.PhysMaterial.IsValid())
-            {
-                RayHit.PhysicalMaterialName = HitResult.PhysMaterial->GetFName();
-                RayHit.Material = GetAcousticMaterial(HitResult.PhysMaterial.Get());
-            }
-            else
-            {
-                RayHit.Material = GetAcousticMaterial(nullptr);
-            }
-
-            OutHits.Add(RayHit);
+            FillRayHit(HitResult, OutHits.AddDefaulted_GetRef());
         }
     }
 }
 
-// ============================================================================
-// STATS & DEBUG
-// ============================================================================
-
-int32 UAcousticEngineSubsystem::GetNumActiveSources() const
+float UAcousticEngineSubsystem::TraceDynamicOcclusion(const FVector& Start, const FVector& End, FAcousticRayHit& OutHit) const
 {
-    int32 Count = 0;
-    for (const auto& Pair : RegisteredSources)
+    UWorld* World = GetWorld();
+    if (!World || !Settings)
     {
-        if (Pair.Value.bIsAudible)
-        {
-            Count++;
-        }
+        return 0.0f;
     }
-    return Count;
-}
 
-// ============================================================================
-// INTERNAL PROCESSING
-// ============================================================================
-
-void UAcousticEngineSubsystem::ProcessAcousticUpdate(float DeltaTime)
-{
-    // Reset ray budget
-    CurrentBudget.OcclusionRays = 0;
-    CurrentBudget.ReflectionRays = 0;
-    CurrentBudget.TotalRaysUsed = 0;
-    CurrentBudget.TotalRaysBudget = Settings->MaxRaysPerFrame;
-
-    // Update accumulators
-    OcclusionUpdateAccumulator += DeltaTime;
-    ReflectionUpdateAccumulator += DeltaTime;
-    ZoneUpdateAccumulator += DeltaTime;
-
-    // Calculate update intervals
-    float OcclusionInterval = 1.0f / Settings->OcclusionUpdateRateHz;
-    float ReflectionInterval = 1.0f / Settings->ReflectionUpdateRateHz;
-    float ZoneInterval = 1.0f / Settings->ZoneUpdateRateHz;
-
-    // Update source priorities
-    UpdateSourcePriorities();
-
-    // Update listener zones if needed
-    if (ZoneUpdateAccumulator >= ZoneInterval)
+    if (ShouldUseGeometryScene())
     {
-        UpdateListenerZones();
-        ZoneUpdateAccumulator = 0.0f;
+        return GeometryScene.TraceSingle(Start, End, OutHit, true) ? ComputeOcclusionFactor(OutHit) : 0.0f;
     }
 
-    // Process occlusion if needed
-    if (OcclusionUpdateAccumulator >= OcclusionInterval)
-    {
-        ProcessOcclusion(DeltaTime);
-        OcclusionUpdateAccumulator = 0.0f;
-    }
+    FHitResult HitResult;
+    bool bHit = World->LineTraceSingleByChannel(
+        HitResult,
+        Start,
+        End,
+        Settings->AudioOcclusionChannel,
+        MakeTraceQueryParams(EQueryMobilityType::Dynamic)
+    );
 
-    // Process reflections if needed
-    if (ReflectionUpdateAccumulator >= ReflectionInterval)
+    if (bHit)
     {
-        ProcessReflections(DeltaTime);
-        ReflectionUpdateAccumulator = 0.0f;
+        FillRayHit(HitResult, OutHit);
+        return ComputeOcclusionFactor(OutHit);
     }
 
-    // Apply parameters to sources
-    ApplyParamsToSources();
+    OutHit.bIsValidHit = false;
+    return 0.0f;
 }
 
-void UAcousticEngineSubsystem::UpdateSourcePriorities()
+bool UAcousticEngineSubsystem::LookupBakedOcclusion(const FVector& ListenerLocation, const FVector& SourceLocation, FAcousticRayHit& OutHit) const
 {
-    if (ListenerDataArray.Num() == 0)
-    {
-        return;
-    }
-
-    const FVector& ListenerLocation = ListenerDataArray[0].Location;
-    int32 AdvancedCount = 0;
-    int32 HeroCount = 0;
-
-    // Calculate priorities and sort
-    TArray<TPair<int32, float>> SortedSources;
-
-    for (auto& Pair : RegisteredSources)
+    for (const UAcousticBakedData* BakedData : ActiveBakedData)
     {
-        FAcousticSourceEntry& Entry = Pair.Value;
-        UAcousticSourceComponent* Source = Entry.SourceComponent.Get();
-
-        if (!Source)
+        bool bOccluded = false;
+        uint8 SurfaceType = 0;
+        if (!BakedData || !BakedData->LookupOcclusion(ListenerLocation, SourceLocation, bOccluded, SurfaceType))
         {
             continue;
         }
 
-        // Calculate distance
-        FVector SourceLocation = Source->GetAcousticLocation();
-        float Distance = FMath::Max(FVector::Dist(SourceLocation, ListenerLocation), AcousticConstants::MinDistance);
-        Entry.CurrentParams.Distance = Distance;
+        OutHit = FAcousticRayHit();
+        OutHit.bIsValidHit = bOccluded;
+        if (bOccluded)
+        {
+            OutHit.MaterialIndex = GetSurfaceMaterialIndex(SurfaceType);
+            OutHit.Distance = FVector::Dist(ListenerLocation, SourceLocation);
+        }
+        return true;
+    }
 
-        // Calculate priority score
-        float Priority = Source->ComputePriorityScore(ListenerLocation);
-        Entry.PriorityScore = Priority;
+    return false;
+}
 
-        SortedSources.Add(TPair<int32, float>(Pair.Key, Priority));
-    }
+uint8 UAcousticEngineSubsystem::GetSurfaceMaterialIndex(uint8 SurfaceType) const
+{
+    // Baked data carries only the surface type; name-mapped materials resolve to the default
+    return MappedSurfaces.IsValidIndex(SurfaceType) && MappedSurfaces[SurfaceType] ?
+        SurfaceType : static_cast<uint8>(SurfaceType_Default);
+}
 
-    // Sort by priority (highest first)
-    SortedSources.Sort([](const TPair<int32, float>& A, const TPair<int32, float>& B) {
-        return A.Value > B.Value;
-    });
+bool UAcousticEngineSubsystem::SampleBakedProbes(const FVector& Location, FAcousticBakedProbeSample& OutSample) const
+{
+    OutSample = FAcousticBakedProbeSample();
 
-    // Assign effective LODs based on budget
-    for (const auto& SortedPair : SortedSources)
+    for (const UAcousticBakedData* BakedData : ActiveBakedData)
     {
-        FAcousticSourceEntry* Entry = RegisteredSources.Find(SortedPair.Key);
-        if (!Entry || !Entry->SourceComponent.IsValid())
+        int32 Cells[8];
+        float Weights[8];
+        const int32 NumProbes = BakedData ? BakedData->GatherProbeWeights(Location, Cells, Weights) : 0;
+        if (NumProbes == 0)
         {
             continue;
         }
 
-        UAcousticSourceComponent* Source = Entry->SourceComponent.Get();
-        EAcousticLOD DesiredLOD = Source->AcousticLOD;
+        float TapWeights[FEarlyReflectionParams::MaxTaps] = {};
+        float RT60Low = 0.0f;
+        float RT60Mid = 0.0f;
+        float RT60High = 0.0f;
 
-        // Distance-based downgrade
-        float Distance = Entry->CurrentParams.Distance;
-        if (Distance > Settings->OffLODDistance)
+        for (int32 p = 0; p < NumProbes; p++)
         {
-            DesiredLOD = EAcousticLOD::Off;
-        }
-        else if (Distance > Settings->BasicLODDistance && DesiredLOD > EAcousticLOD::Basic)
+            const FAcousticBakedProbe& Probe = BakedData->GetProbe(Cells[p]);
+            const float Weight = Weights[p];
+
+            // Band absorption of the surfaces the probe saw
+            float Low = 0.0f;
+            float Mid = 0.0f;
+            float High = 0.0f;
+            float SurfaceTotal = 0.0f;
+            for (int32 Slot = 0; Slot < FAcousticBakedProbe::MaxSurfaces; Slot++)
+            {
+                const float SurfaceWeight = Probe.SurfaceWeights[Slot] / 255.0f;
+                if (SurfaceWeight > 0.0f)
+                {
+                    const FAcousticMaterial& Material = GetMaterialByIndex(GetSurfaceMaterialIndex(Probe.SurfaceTypes[Slot]));
+                    Low += SurfaceWeight * Material.LowAbsorption;
+                    Mid += SurfaceWeight * Material.MidAbsorption;
+                    High += SurfaceWeight * Material.HighAbsorption;
+                    SurfaceTotal += SurfaceWeight;
+                }
+            }
+            if (SurfaceTotal > 0.0f)
+            {
+                Low /= SurfaceTotal;
+                Mid /= SurfaceTotal;
+                High /= SurfaceTotal;
+            }
+
+            // Escaped rays leave the room for good - treat them as fully absorbed
+            const float Closed = 1.0f - Probe.OpenFraction;
+            const float MeanFreePath = Probe.MeanFreePath / 100.0f;
+            RT60Low += Weight * AcousticConstants::EstimateRT60(MeanFreePath, Probe.OpenFraction + Closed * Low);
+            RT60Mid += Weight * AcousticConstants::EstimateRT60(MeanFreePath, Probe.OpenFraction + Closed * Mid);
+            RT60High += Weight * AcousticConstants::EstimateRT60(MeanFreePath, Probe.OpenFraction + Closed * High);
+            OutSample.ReflectionDensity += Weight * Closed;
+
+            // Blend taps slot by slot - slot N is each probe's Nth earliest reflector
+            const TConstArrayView<FAcousticBakedTap> Taps = BakedData->GetProbeTaps(Cells[p]);
+            for (int32 t = 0; t < Taps.Num(); t++)
+            {
+                const FAcousticMaterial& Material = GetMaterialByIndex(GetSurfaceMaterialIndex(Taps[t].SurfaceType));
+                FAcousticBakedProbeSample::FTap& Tap = OutSample.Taps[t];
+                Tap.Direction += Weight * FVector(Taps[t].Direction);
+                Tap.Distance += Weight * Taps[t].Distance;
+                Tap.AverageAbsorption += Weight * Material.GetAverageAbsorption();
+                Tap.HighAbsorption += Weight * Material.HighAbsorption;
+                TapWeights[t] += Weight;
+            }
+        }
+
+        // Keep a slot while most of the interpolation weight has a reflector for it
+        for (int32 t = 0; t < FEarlyReflectionParams::MaxTaps && TapWeights[t] >= 0.5f; t++)
         {
-            DesiredLOD = EAcousticLOD::Basic;
+            FAcousticBakedProbeSample::FTap& Tap = OutSample.Taps[t];
+            Tap.Direction = Tap.Direction.GetSafeNormal();
+            Tap.Distance /= TapWeights[t];
+            Tap.AverageAbsorption /= TapWeights[t];
+            Tap.HighAbsorption /= TapWeights[t];
+            OutSample.NumTaps++;
         }
 
-        // Budget-based downgrade
-        if (DesiredLOD == EAcousticLOD::Hero)
+        OutSample.RT60 = FMath::Clamp(RT60Mid, 0.1f, 20.0f);
+        OutSample.HFDecay = FMath::Clamp(RT60High / FMath::Max(RT60Mid, KINDA_SMALL_NUMBER), 0.1f, 2.0f);
+        OutSample.LFDecay = FMath::Clamp(RT60Low / FMath::Max(RT60Mid, KINDA_SMALL_NUMBER), 0.1f, 2.0f);
+        OutSample.bIsValid = true;
+        return true;
+    }
+
+    return false;
+}
+
+FCollisionQueryParams UAcousticEngineSubsystem::MakeTraceQueryParams(EQueryMobilityType MobilityType) const
+{
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AcousticTrace));
+    QueryParams.bTraceComplex = Settings->bUseComplexCollision;
+    QueryParams.bReturnPhysicalMaterial = true;
+    QueryParams.MobilityType = MobilityType;
+    return QueryParams;
+}
+
+void UAcousticEngineSubsystem::FillRayHit(const FHitResult& HitResult, FAcousticRayHit& OutHit) const
+{
+    // Hit results hold weak UObject pointers
+    check(IsInGameThread());
+
+    OutHit.bIsValidHit = true;
+    OutHit.HitLocation = HitResult.ImpactPoint;
+    OutHit.HitNormal = HitResult.ImpactNormal;
+    OutHit.Distance = HitResult.Distance;
+    OutHit.MaterialIndex = ResolveMaterialIndex(HitResult.PhysMaterial.Get());
+
+    const UPrimitiveComponent* HitComponent = HitResult.GetComponent();
+    OutHit.bIsDynamicHit = HitComponent && HitComponent->Mobility == EComponentMobility::Movable;
+}
+
+// ============================================================================
+// ASYNC TRACES
+// ============================================================================
+
+bool UAcousticEngineSubsystem::IssueAsyncOcclusionTrace(int32 DenseIndex, const FVector& Start, const FVector& End)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    FAcousticPendingOcclusionTrace& Pending = Sources.ColdData[DenseIndex].PendingOcclusion;
+    if (Pending.IssueFrame == 0)
+    {
+        NumPendingOcclusionTraces++;
+    }
+
+    Pending.Handle = World->AsyncLineTraceByChannel(
+        EAsyncTraceType::Single,
+        Start,
+        End,
+        Settings->AudioOcclusionChannel,
+        MakeTraceQueryParams()
+    );
+    Pending.IssueFrame = GFrameCounter;
+    Pending.SourceLocation = End;
+    Pending.ListenerLocation = Start;
+    return true;
+}
+
+void UAcousticEngineSubsystem::ConsumeAsyncTraces()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const double CurrentTime = FPlatformTime::Seconds();
+
+    // Occlusion results issued last frame
+    for (int32 i = 0; i < Sources.Num() && NumPendingOcclusionTraces > 0; i++)
+    {
+        FAcousticPendingOcclusionTrace& Pending = Sources.ColdData[i].PendingOcclusion;
+        if (Pending.IssueFrame == 0 || Pending.IssueFrame == GFrameCounter)
         {
-            if (HeroCount >= Settings->MaxHeroSources)
+            continue; // Nothing in flight, or issued this frame and not resolved yet
+        }
+
+        FTraceDatum Datum;
+        if (World->QueryTraceData(Pending.Handle, Datum))
+        {
+            FAcousticRayHit OcclusionHit;
+            float Occlusion = 0.0f;
+            if (Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit)
             {
-                DesiredLOD = EAcousticLOD::Advanced;
+                FillRayHit(Datum.OutHits[0], OcclusionHit);
+                Occlusion = ComputeOcclusionFactor(OcclusionHit);
+            }
+
+            // The validity region is centred on the positions the ray was traced between
+            Sources.OcclusionSourceOrigins[i] = Pending.SourceLocation;
+            Sources.OcclusionListenerOrigins[i] = Pending.ListenerLocation;
+            ApplyOcclusionResult(i, OcclusionHit, Occlusion, CurrentTime);
+
+            // Served - a dropped request keeps its deadline and is issued again
+            Sources.OcclusionDeficits[i] = 0.0f;
+            Sources.NextOcclusionUpdateTimes[i] = AcousticConstants::AdvanceDeadline(
+                Sources.NextOcclusionUpdateTimes[i],
+                GetOcclusionInterval(Sources.EffectiveLODs[i]),
+                Sources.UpdatePhases[i],
+                CurrentTime);
+        }
+
+        // Async trace data only lives for one frame - drop stale requests as well
+        Pending = FAcousticPendingOcclusionTrace();
+        NumPendingOcclusionTraces--;
+    }
+
+    // Reflection probe slices and path bounces issued last frame
+    for (FAcousticReflectionProbe& Probe : ReflectionProbes)
+    {
+        // Each landed bounce extends its path by one vertex and queues the next one
+        for (int32 p = Probe.PendingPathTraces.Num() - 1; p >= 0; p--)
+        {
+            FAcousticPendingPathTrace& PathTrace = Probe.PendingPathTraces[p];
+            if (!PathTrace.Handle.IsValid())
+            {
+                continue; // Queued, not issued yet
+            }
+
+            FTraceDatum Datum;
+            const bool bLanded = World->QueryTraceData(PathTrace.Handle, Datum) &&
+                Probe.PathGenerations[PathTrace.RayIndex] == PathTrace.Generation &&
+                Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit;
+
+            FAcousticRayHit BounceHit;
+            if (bLanded)
+            {
+                FillRayHit(Datum.OutHits[0], BounceHit);
+            }
+
+            // A miss, a dropped result or a re-traced ray ends the path here
+            if (bLanded && ExtendProbePath(Probe, PathTrace.RayIndex, PathTrace.Bounce, BounceHit,
+                PathTrace.Direction, PathTrace.Start, PathTrace.Direction))
+            {
+                PathTrace.Handle = FTraceHandle();
+                PathTrace.Bounce++;
             }
             else
             {
-                HeroCount++;
+                Probe.PendingPathTraces.RemoveAtSwap(p, 1, EAllowShrinking::No);
             }
         }
 
-        if (DesiredLOD == EAcousticLOD::Advanced)
+        if (Probe.PendingTraces.Num() == 0)
         {
-            if (AdvancedCount >= Settings->MaxAdvancedSources)
+            continue;
+        }
+
+        // Each ray owns a slot, so an unresolved trace just keeps its previous result
+        for (int32 k = 0; k < Probe.PendingTraces.Num(); k++)
+        {
+            FTraceDatum Datum;
+            if (!World->QueryTraceData(Probe.PendingTraces[k], Datum))
             {
-                DesiredLOD = EAcousticLOD::Basic;
+                continue;
+            }
+
+            FAcousticRayHit& RayHit = Probe.RayHits[(Probe.PendingFirstRay + k) % Probe.NumRays];
+            if (Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit)
+            {
+                FillRayHit(Datum.OutHits[0], RayHit);
             }
             else
             {
-                AdvancedCount++;
+                RayHit = FAcousticRayHit();
+            }
+        }
+
+        // Every ray of the slice restarts its path; the first bounce goes out with the next probe update
+        for (int32 k = 0; k < Probe.PendingTraces.Num(); k++)
+        {
+            FAcousticPendingPathTrace PathTrace;
+            PathTrace.RayIndex = (Probe.PendingFirstRay + k) % Probe.NumRays;
+            if (BeginProbePath(Probe, PathTrace.RayIndex, PathTrace.Start, PathTrace.Direction))
+            {
+                PathTrace.Generation = Probe.PathGenerations[PathTrace.RayIndex];
+                PathTrace.Bounce = 1;
+                Probe.PendingPathTraces.Add(PathTrace);
             }
         }
 
-        Entry->EffectiveLOD = DesiredLOD;
-        Entry->bIsAudible = (DesiredLOD != EAcousticLOD::Off);
+        Probe.PendingTraces.Reset();
+        RebuildProbeHits(Probe);
+    }
+}
+
+// ============================================================================
+// STATS & DEBUG
+// ============================================================================
+
+int32 UAcousticEngineSubsystem::GetNumActiveSources() const
+{
+    if (IsSimulationInFlight())
+    {
+        return PublishedActiveSources;
+    }
+
+    int32 Count = 0;
+    for (const bool bIsAudible : Sources.AudibleFlags)
+    {
+        Count += bIsAudible ? 1 : 0;
+    }
+    return Count;
+}
+
+// ============================================================================
+// INTERNAL PROCESSING
+// ============================================================================
+
+void UAcousticEngineSubsystem::ProcessAcousticUpdate(float DeltaTime)
+{
+    BeginAcousticUpdate(DeltaTime);
+    RunSimulation(DeltaTime);
+    FinishAcousticUpdate();
+}
+
+void UAcousticEngineSubsystem::TickAsyncSimulation(float DeltaTime)
+{
+    SimulationDeltaTime += DeltaTime;
+
+    // Previous update still running - queries keep being served from the read buffer
+    if (SimulationTask.IsValid())
+    {
+        if (!SimulationTask.IsCompleted())
+        {
+            return;
+        }
+        SimulationTask = UE::Tasks::FTask();
+    }
+
+    // Deliver the previous update's results
+    if (bSimulationResultsPending)
+    {
+        FinishAcousticUpdate();
+    }
+
+    // The registry is quiescent until the next launch
+    if (Settings->bEnableDebugVisualization)
+    {
+        DrawDebugVisualization();
+    }
+
+    // Frames skipped while the worker overran are folded into this update
+    const float UpdateDeltaTime = SimulationDeltaTime;
+    SimulationDeltaTime = 0.0f;
+
+    BeginAcousticUpdate(UpdateDeltaTime);
+
+    // World traces resolve physical materials and components, which only the game thread may touch
+    if (!CanRunSimulationOnWorker())
+    {
+        RunSimulation(UpdateDeltaTime);
+        FinishAcousticUpdate();
+        return;
+    }
+
+    PublishReadBuffer();
+
+    bSimulationResultsPending = true;
+    SimulationTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, UpdateDeltaTime]()
+    {
+        RunSimulation(UpdateDeltaTime);
+    });
+}
+
+void UAcousticEngineSubsystem::BeginAcousticUpdate(float DeltaTime)
+{
+    // Zone lookups for this frame are served from the grid and listener cache
+    if (bZoneIndexDirty)
+    {
+        ZoneIndex.Build(RegisteredZones, Settings->ZoneGridCellSize);
+        bZoneIndexDirty = false;
+        bSourceZonesDirty = true;
+    }
+    RefreshListenerZoneCache();
+    UpdatePortalGraph();
+
+    if (Settings->bUseAcousticGeometryScene)
+    {
+        UpdateGeometryScene();
+    }
+
+    // Zones are cheap and per-listener - keep them on a global rate
+    ZoneUpdateAccumulator += DeltaTime;
+    float ZoneInterval = 1.0f / Settings->ZoneUpdateRateHz;
+
+    // Update listener zones if needed
+    if (ZoneUpdateAccumulator >= ZoneInterval)
+    {
+        UpdateListenerZones();
+        ZoneUpdateAccumulator = 0.0f;
+    }
+
+    // Results of async traces issued last frame must be read this frame
+    ConsumeAsyncTraces();
+
+    PublishSimulationFrame();
+    ApplyOcclusionInvalidations();
+}
+
+void UAcousticEngineSubsystem::RunSimulation(float DeltaTime)
+{
+    // Update source priorities
+    UpdateSourcePriorities();
+
+    // Ray budget is a smooth quota: the steady-state demand of the active
+    // sources spread evenly over frames, capped by the hard per-frame limit
+    const float FrameDemand = ComputeRayDemandPerSecond() * DeltaTime;
+    const float Quota = FrameDemand + RayQuotaCarry;
+    CurrentBudget.OcclusionRays = 0;
+    CurrentBudget.ReflectionRays = 0;
+    CurrentBudget.TotalRaysUsed = 0;
+    CurrentBudget.OcclusionCacheHits = 0;
+    CurrentBudget.BakedOcclusionLookups = 0;
+    CurrentBudget.BakedReflectionUpdates = 0;
+    CurrentBudget.TotalRaysBudget = FMath::Min(FMath::FloorToInt(Quota), Settings->MaxRaysPerFrame);
+
+    // Sources with a due deadline are traced every frame; phases keep the load flat
+    ProcessOcclusion(DeltaTime);
+    ProcessReflections(DeltaTime);
+
+    // Carry the fractional remainder, plus at most one frame of backlog
+    RayQuotaCarry = FMath::Clamp(Quota - CurrentBudget.TotalRaysUsed, 0.0f, FrameDemand + 1.0f);
+}
+
+void UAcousticEngineSubsystem::FinishAcousticUpdate()
+{
+    bSimulationResultsPending = false;
+
+    UpdateStalenessStats();
+    PublishedBudget = CurrentBudget;
+
+    // Apply parameters to sources
+    ApplyParamsToSources();
+}
+
+void UAcousticEngineSubsystem::PublishSimulationFrame()
+{
+    SimulationFrame.Listeners = ListenerDataArray;
+    SimulationFrame.ZonePresets = ListenerZonePresets;
+    SimulationFrame.ProbeSamples = ListenerProbeSamples;
+
+    SimulationFrame.ListenerZoneNodes.SetNum(ListenerZones.Num());
+    SimulationFrame.AudibleZoneSets.SetNum(ListenerZones.Num());
+    for (int32 i = 0; i < ListenerZones.Num(); i++)
+    {
+        const int32 ListenerNode = PortalGraph.FindZoneNode(ListenerZones[i].Get());
+        SimulationFrame.ListenerZoneNodes[i] = ListenerNode;
+
+        // Only a zone change or a portal opening or closing moves the audible set
+        FAcousticAudibleZoneSet& AudibleSet = SimulationFrame.AudibleZoneSets[i];
+        if (!PortalGraph.IsAudibleSetCurrent(AudibleSet, ListenerNode))
+        {
+            PortalGraph.ComputeAudibleSet(ListenerNode, AudibleSet);
+        }
+    }
+
+    // Source transforms and priority inputs are the only component state the simulation reads
+    RefreshMovedSources();
+    GatherCandidateSources();
+}
+
+void UAcousticEngineSubsystem::RefreshMovedSources()
+{
+    // Zone lookups per source are only needed while there are portals to route through or cull behind
+    const bool bNeedSourceZones = (Settings->bEnablePortalPropagation || Settings->bCullUnreachableZones) &&
+        !PortalGraph.IsEmpty();
+    if (bNeedSourceZones != bTrackingSourceZones)
+    {
+        bTrackingSourceZones = bNeedSourceZones;
+        bSourceZonesDirty = true;
+    }
+
+    // One cell per gather radius keeps a query to 27 cells
+    if (SourceGrid.GetCellSize() != Settings->OffLODDistance)
+    {
+        SourceGrid.SetCellSize(Settings->OffLODDistance);
+        for (int32 i = 0; i < Sources.Num(); i++)
+        {
+            SourceGrid.Update(Sources.SourceIds[i], Sources.Positions[i]);
+        }
+    }
+
+    for (const int32 SourceId : MovedSourceIds)
+    {
+        const int32 DenseIndex = Sources.FindDense(SourceId);
+        if (DenseIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        Sources.MovedFlags[DenseIndex] = false;
+        const UAcousticSourceComponent* Source = Sources.Components[DenseIndex].Get();
+        if (!Source)
+        {
+            continue;
+        }
+
+        const FVector Location = Source->GetAcousticLocation();
+        Sources.Positions[DenseIndex] = Location;
+        SourceGrid.Update(SourceId, Location);
+        checkSlow(SourceGrid.IsInCellOf(SourceId, Location));
+
+        if (bNeedSourceZones)
+        {
+            Sources.ZoneNodes[DenseIndex] = PortalGraph.FindZoneNode(ZoneIndex.FindZone(Location));
+        }
+    }
+    MovedSourceIds.Reset();
+
+    // Node indices are only stable until the zone grid or the portal graph is rebuilt
+    if (bSourceZonesDirty)
+    {
+        for (int32 i = 0; i < Sources.Num(); i++)
+        {
+            Sources.ZoneNodes[i] = bNeedSourceZones ?
+                PortalGraph.FindZoneNode(ZoneIndex.FindZone(Sources.Positions[i])) : FAcousticPortalGraph::OutsideNode;
+        }
+        bSourceZonesDirty = false;
+    }
+}
+
+void UAcousticEngineSubsystem::GatherCandidateSources()
+{
+    GatherStamp++;
+    SimulationFrame.CandidateSources.Reset();
+    SimulationFrame.ReleasedSources.Reset();
+
+    TArray<int32> PreviousIds = MoveTemp(GatheredSourceIds);
+    GatheredSourceIds.Reset();
+
+    for (const FAcousticListenerData& Listener : SimulationFrame.Listeners)
+    {
+        SourceGrid.GatherInRadius(Listener.Location, Settings->OffLODDistance, GatheredSourceIds);
+    }
+
+    // Overlapping listener ranges report a source more than once - keep the first
+    int32 NumGathered = 0;
+    for (int32 k = 0; k < GatheredSourceIds.Num(); k++)
+    {
+        const int32 SourceId = GatheredSourceIds[k];
+        const int32 DenseIndex = Sources.FindDense(SourceId);
+        if (DenseIndex == INDEX_NONE || Sources.GatherStamps[DenseIndex] == GatherStamp)
+        {
+            continue;
+        }
+
+        Sources.GatherStamps[DenseIndex] = GatherStamp;
+        GatheredSourceIds[NumGathered++] = SourceId;
+        SimulationFrame.CandidateSources.Add(DenseIndex);
+
+        if (const UAcousticSourceComponent* Source = Sources.Components[DenseIndex].Get())
+        {
+            Sources.PriorityInputs[DenseIndex] = Source->GetPriorityInputs();
+        }
+        else
+        {
+            Sources.PriorityInputs[DenseIndex].bIsValid = false;
+        }
+    }
+    GatheredSourceIds.SetNum(NumGathered, EAllowShrinking::No);
+
+    // Everything else is already Off - only the sources that just left range need switching off
+    for (const int32 SourceId : PreviousIds)
+    {
+        const int32 DenseIndex = Sources.FindDense(SourceId);
+        if (DenseIndex != INDEX_NONE && Sources.GatherStamps[DenseIndex] != GatherStamp)
+        {
+            SimulationFrame.ReleasedSources.Add(DenseIndex);
+        }
+    }
+}
+
+void UAcousticEngineSubsystem::PublishReadBuffer()
+{
+    PublishedParams.SetNum(Sources.Num(), EAllowShrinking::No);
+    PublishedActiveSources = 0;
+
+    for (int32 i = 0; i < Sources.Num(); i++)
+    {
+        PublishedParams[i] = Sources.ColdData[i].CurrentParams;
+        PublishedActiveSources += Sources.AudibleFlags[i] ? 1 : 0;
     }
 }
 
-void UAcousticEngineSubsystem::ProcessOcclusion(float DeltaTime)
+void UAcousticEngineSubsystem::WaitForSimulation()
+{
+    if (SimulationTask.IsValid())
+    {
+        SimulationTask.Wait();
+        SimulationTask = UE::Tasks::FTask();
+    }
+}
+
+void UAcousticEngineSubsystem::UpdateSourcePriorities()
+{
+    if (SimulationFrame.Listeners.Num() == 0)
+    {
+        CurrentBudget.AdvancedSources = 0;
+        CurrentBudget.HeroSources = 0;
+        return;
+    }
+
+    const FVector& ListenerLocation = SimulationFrame.Listeners[0].Location;
+    const double CurrentTime = FPlatformTime::Seconds();
+    const bool bCullZones = Settings->bCullUnreachableZones && !PortalGraph.IsEmpty();
+    int32 AdvancedCount = 0;
+    int32 HeroCount = 0;
+    int32 ZoneCulledCount = 0;
+
+    // Sources that left every listener's range stop costing anything
+    for (const int32 i : SimulationFrame.ReleasedSources)
+    {
+        Sources.EffectiveLODs[i] = EAcousticLOD::Off;
+        Sources.AudibleFlags[i] = false;
+        Sources.OcclusionDeficits[i] = 0.0f;
+    }
+
+    // Only sources gathered near a listener are scored; the rest stay Off
+    TArray<int32, TInlineAllocator<256>> SortedSources;
+    SortedSources.Reserve(SimulationFrame.CandidateSources.Num());
+
+    for (const int32 i : SimulationFrame.CandidateSources)
+    {
+        const FAcousticSourcePriorityInputs& Inputs = Sources.PriorityInputs[i];
+        if (!Inputs.bIsValid)
+        {
+            Sources.EffectiveLODs[i] = EAcousticLOD::Off;
+            Sources.AudibleFlags[i] = false;
+            continue;
+        }
+
+        // Sealed off from every listener - hold an occluded result and never trace
+        if (bCullZones && !IsZoneNodeAudible(Sources.ZoneNodes[i]))
+        {
+            if (!Sources.ZoneCulledFlags[i])
+            {
+                ApplyZoneCulledResult(i, CurrentTime);
+            }
+            Sources.EffectiveLODs[i] = EAcousticLOD::Off;
+            Sources.AudibleFlags[i] = false;
+            ZoneCulledCount++;
+            continue;
+        }
+
+        // Reachable again - trace right away instead of waiting out the old deadline
+        if (Sources.ZoneCulledFlags[i])
+        {
+            Sources.ZoneCulledFlags[i] = false;
+            Sources.NextOcclusionUpdateTimes[i] = 0.0;
+        }
+
+        const float Distance = FMath::Max(FVector::Dist(Sources.Positions[i], ListenerLocation), AcousticConstants::MinDistance);
+
+        Sources.Distances[i] = Distance;
+        Sources.PriorityScores[i] = Inputs.ComputeScore(Distance);
+        Sources.ColdData[i].CurrentParams.Distance = Distance;
+
+        SortedSources.Add(i);
+    }
+
+    // Sort by priority (highest first)
+    const TArray<float>& PriorityScores = Sources.PriorityScores;
+    SortedSources.Sort([&PriorityScores](int32 A, int32 B) {
+        return PriorityScores[A] > PriorityScores[B];
+    });
+
+    // Assign effective LODs based on budget
+    for (const int32 i : SortedSources)
+    {
+        EAcousticLOD DesiredLOD = Sources.PriorityInputs[i].RequestedLOD;
+
+        // Distance-based downgrade
+        const float Distance = Sources.Distances[i];
+        if (Distance > Settings->OffLODDistance)
+        {
+            DesiredLOD = EAcousticLOD::Off;
+        }
+        else if (Distance > Settings->BasicLODDistance && DesiredLOD > EAcousticLOD::Basic)
+        {
+            DesiredLOD = EAcousticLOD::Basic;
+        }
+
+        // Budget-based downgrade
+        if (DesiredLOD == EAcousticLOD::Hero)
+        {
+            if (HeroCount >= Settings->MaxHeroSources)
+            {
+                DesiredLOD = EAcousticLOD::Advanced;
+            }
+            else
+            {
+                HeroCount++;
+            }
+        }
+
+        if (DesiredLOD == EAcousticLOD::Advanced)
+        {
+            if (AdvancedCount >= Settings->MaxAdvancedSources)
+            {
+                DesiredLOD = EAcousticLOD::Basic;
+            }
+            else
+            {
+                AdvancedCount++;
+            }
+        }
+
+        Sources.EffectiveLODs[i] = DesiredLOD;
+        Sources.AudibleFlags[i] = (DesiredLOD != EAcousticLOD::Off);
+    }
+
+    CurrentBudget.ZoneCulledSources = ZoneCulledCount;
+    CurrentBudget.GatheredSources = SimulationFrame.CandidateSources.Num();
+
+    // The shared probe is sized from these instead of another pass over the sources
+    CurrentBudget.AdvancedSources = AdvancedCount;
+    CurrentBudget.HeroSources = HeroCount;
+}
+
+void UAcousticEngineSubsystem::ProcessOcclusion(float DeltaTime)
+{
+    if (SimulationFrame.Listeners.Num() == 0)
+    {
+        return;
+    }
+
+    const FVector& ListenerLocation = SimulationFrame.Listeners[0].Location;
+    double CurrentTime = FPlatformTime::Seconds();
+    const bool bAsyncTraces = ShouldUseAsyncTraces();
+
+    // Gather sources whose deadline is due; each waiting source earns credit for its LOD
+    TArray<int32, TInlineAllocator<256>> Candidates;
+    Candidates.Reserve(SimulationFrame.CandidateSources.Num());
+
+    // Sources outside every listener's range are Off and have no deadline worth checking
+    for (const int32 i : SimulationFrame.CandidateSources)
+    {
+        const EAcousticLOD LOD = Sources.EffectiveLODs[i];
+        if (LOD == EAcousticLOD::Off)
+        {
+            Sources.OcclusionDeficits[i] = 0.0f;
+            continue;
+        }
+
+        if (CurrentTime < Sources.NextOcclusionUpdateTimes[i])
+        {
+            continue; // Use cached data
+        }
+
+        // One request in flight per source; its deadline moves when the result lands next frame
+        if (bAsyncTraces && Sources.ColdData[i].PendingOcclusion.IssueFrame != 0)
+        {
+            continue;
+        }
+
+        // Due, but neither end left the validity region - the cached result still holds
+        if (IsOcclusionCacheValid(i, ListenerLocation, CurrentTime))
+        {
+            Sources.NextOcclusionUpdateTimes[i] = AcousticConstants::AdvanceDeadline(
+                Sources.NextOcclusionUpdateTimes[i],
+                GetOcclusionInterval(LOD),
+                Sources.UpdatePhases[i],
+                CurrentTime);
+            CurrentBudget.OcclusionCacheHits++;
+            continue;
+        }
+
+        // Basic sources inside a bake read static occlusion from the table; only
+        // movable geometry still needs a ray, and that ray is optional under load
+        FAcousticRayHit BakedHit;
+        if (LOD == EAcousticLOD::Basic && Settings->bUseBakedOcclusion &&
+            LookupBakedOcclusion(ListenerLocation, Sources.Positions[i], BakedHit))
+        {
+            float Occlusion = ComputeOcclusionFactor(BakedHit);
+
+            if (Settings->bTraceDynamicOccluders && CurrentBudget.TotalRaysUsed < CurrentBudget.TotalRaysBudget)
+            {
+                FAcousticRayHit DynamicHit;
+                const float DynamicOcclusion = TraceDynamicOcclusion(ListenerLocation, Sources.Positions[i], DynamicHit);
+                if (DynamicOcclusion > Occlusion)
+                {
+                    BakedHit = DynamicHit;
+                    Occlusion = DynamicOcclusion;
+                }
+                CurrentBudget.OcclusionRays++;
+                CurrentBudget.TotalRaysUsed++;
+            }
+
+            Sources.OcclusionSourceOrigins[i] = Sources.Positions[i];
+            Sources.OcclusionListenerOrigins[i] = ListenerLocation;
+            ApplyOcclusionResult(i, BakedHit, Occlusion, CurrentTime);
+
+            Sources.OcclusionDeficits[i] = 0.0f;
+            Sources.NextOcclusionUpdateTimes[i] = AcousticConstants::AdvanceDeadline(
+                Sources.NextOcclusionUpdateTimes[i],
+                GetOcclusionInterval(LOD),
+                Sources.UpdatePhases[i],
+                CurrentTime);
+            CurrentBudget.BakedOcclusionLookups++;
+            continue;
+        }
+
+        Sources.OcclusionDeficits[i] += GetSchedulerWeight(LOD);
+        Candidates.Add(i);
+    }
+
+    // Overdue sources first, then by accumulated credit, then by priority. Credit
+    // keeps growing while a source waits, so a low-priority source always
+    // overtakes fresher high-priority ones within a bounded number of updates.
+    const double MaxStaleness = Settings->MaxOcclusionStaleness;
+    const TArray<double>& LastUpdateTimes = Sources.LastOcclusionUpdateTimes;
+    const TArray<float>& Deficits = Sources.OcclusionDeficits;
+    const TArray<float>& PriorityScores = Sources.PriorityScores;
+    Candidates.Sort([&](int32 A, int32 B) {
+        const bool bOverdueA = (CurrentTime - LastUpdateTimes[A]) > MaxStaleness;
+        const bool bOverdueB = (CurrentTime - LastUpdateTimes[B]) > MaxStaleness;
+        if (bOverdueA != bOverdueB)
+        {
+            return bOverdueA;
+        }
+        if (bOverdueA)
+        {
+            return LastUpdateTimes[A] < LastUpdateTimes[B];
+        }
+        if (Deficits[A] != Deficits[B])
+        {
+            return Deficits[A] > Deficits[B];
+        }
+        return PriorityScores[A] > PriorityScores[B];
+    });
+
+    for (const int32 i : Candidates)
+    {
+        // Check ray budget
+        if (CurrentBudget.TotalRaysUsed >= CurrentBudget.TotalRaysBudget)
+        {
+            break;
+        }
+
+        const FVector& SourceLocation = Sources.Positions[i];
+
+        if (bAsyncTraces)
+        {
+            // Cache origins, credit and deadline move only once the result is applied
+            if (!IssueAsyncOcclusionTrace(i, ListenerLocation, SourceLocation))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            // The validity region is centred on the positions this ray is traced between
+            Sources.OcclusionSourceOrigins[i] = SourceLocation;
+            Sources.OcclusionListenerOrigins[i] = ListenerLocation;
+
+            // Trace occlusion
+            FAcousticRayHit OcclusionHit;
+            float Occlusion = TraceOcclusion(ListenerLocation, SourceLocation, OcclusionHit);
+            ApplyOcclusionResult(i, OcclusionHit, Occlusion, CurrentTime);
+
+            // Served - spend the accumulated credit and schedule the next update
+            Sources.OcclusionDeficits[i] = 0.0f;
+            Sources.NextOcclusionUpdateTimes[i] = AcousticConstants::AdvanceDeadline(
+                Sources.NextOcclusionUpdateTimes[i],
+                GetOcclusionInterval(Sources.EffectiveLODs[i]),
+                Sources.UpdatePhases[i],
+                CurrentTime);
+        }
+
+        CurrentBudget.OcclusionRays++;
+        CurrentBudget.TotalRaysUsed++;
+    }
+}
+
+float UAcousticEngineSubsystem::GetUpdateInterval(float BaseRateHz, EAcousticLOD LOD) const
+{
+    float Scale = 1.0f;
+    switch (LOD)
+    {
+    case EAcousticLOD::Hero:
+        Scale = Settings->HeroUpdateRateScale;
+        break;
+    case EAcousticLOD::Advanced:
+        Scale = Settings->AdvancedUpdateRateScale;
+        break;
+    case EAcousticLOD::Basic:
+        Scale = Settings->BasicUpdateRateScale;
+        break;
+    default:
+        break;
+    }
+
+    return 1.0f / FMath::Max(BaseRateHz * Scale, KINDA_SMALL_NUMBER);
+}
+
+float UAcousticEngineSubsystem::GetOcclusionInterval(EAcousticLOD LOD) const
+{
+    const float Interval = GetUpdateInterval(Settings->OcclusionUpdateRateHz, LOD);
+
+    // Non-priority sources never refresh faster than the occlusion cache allows
+    if (LOD == EAcousticLOD::Basic)
+    {
+        return FMath::Max(Interval, Settings->OcclusionCacheFrames / 60.0f);
+    }
+    return Interval;
+}
+
+int32 UAcousticEngineSubsystem::GetProbeRayCount() const
+{
+    // Advanced sources need no live probe while baked probes cover the listener
+    const bool bAdvancedBaked = SimulationFrame.ProbeSamples.IsValidIndex(0) && SimulationFrame.ProbeSamples[0].bIsValid;
+
+    // Size the shared probe for the highest LOD that needs it
+    if (CurrentBudget.HeroSources > 0)
+    {
+        return Settings->HeroReflectionRays;
+    }
+    return CurrentBudget.AdvancedSources > 0 && !bAdvancedBaked ? Settings->AdvancedReflectionRays : 0;
+}
+
+int32 UAcousticEngineSubsystem::GetProbeBounceCount() const
+{
+    // Later bounces are only followed for hero sources
+    return CurrentBudget.HeroSources > 0 ? FMath::Clamp(Settings->MaxBounces, 1, 4) : 1;
+}
+
+float UAcousticEngineSubsystem::ComputeRayDemandPerSecond() const
+{
+    float Demand = 0.0f;
+    for (const int32 i : SimulationFrame.CandidateSources)
+    {
+        const EAcousticLOD LOD = Sources.EffectiveLODs[i];
+        if (LOD != EAcousticLOD::Off)
+        {
+            Demand += 1.0f / GetOcclusionInterval(LOD);
+        }
+    }
+
+    // One full probe sweep per reflection interval, each ray up to a full path
+    Demand += GetProbeRayCount() * GetProbeBounceCount() * Settings->ReflectionUpdateRateHz;
+    return Demand;
+}
+
+float UAcousticEngineSubsystem::GetSchedulerWeight(EAcousticLOD LOD) const
+{
+    switch (LOD)
+    {
+    case EAcousticLOD::Hero:
+        return Settings->HeroSchedulerWeight;
+    case EAcousticLOD::Advanced:
+        return Settings->AdvancedSchedulerWeight;
+    case EAcousticLOD::Basic:
+        return Settings->BasicSchedulerWeight;
+    default:
+        return 0.0f;
+    }
+}
+
+bool UAcousticEngineSubsystem::IsOcclusionCacheValid(int32 DenseIndex, const FVector& ListenerLocation, double CurrentTime) const
+{
+    if (!Settings->bEnableOcclusionCache || !Sources.OcclusionCacheValid[DenseIndex])
+    {
+        return false;
+    }
+
+    if (CurrentTime - Sources.LastOcclusionUpdateTimes[DenseIndex] > Settings->OcclusionCacheMaxAge)
+    {
+        return false;
+    }
+
+    // The path's angular error is what matters, so the region grows with distance
+    const float Tolerance = FMath::Max(
+        Settings->OcclusionCacheMinTolerance,
+        Sources.Distances[DenseIndex] * Settings->OcclusionCacheToleranceRatio);
+    const float ToleranceSq = Tolerance * Tolerance;
+
+    return FVector::DistSquared(Sources.Positions[DenseIndex], Sources.OcclusionSourceOrigins[DenseIndex]) <= ToleranceSq &&
+        FVector::DistSquared(ListenerLocation, Sources.OcclusionListenerOrigins[DenseIndex]) <= ToleranceSq;
+}
+
+void UAcousticEngineSubsystem::ApplyOcclusionInvalidations()
+{
+    if (PendingOcclusionInvalidations.Num() == 0)
+    {
+        return;
+    }
+
+    for (int32 i = 0; i < Sources.Num(); i++)
+    {
+        if (!Sources.OcclusionCacheValid[i])
+        {
+            continue;
+        }
+
+        // Invalidate when the cached sound path passes through the sphere
+        for (const FSphere& Sphere : PendingOcclusionInvalidations)
+        {
+            const double DistSq = FMath::PointDistToSegmentSquared(
+                Sphere.Center, Sources.OcclusionListenerOrigins[i], Sources.OcclusionSourceOrigins[i]);
+            if (DistSq <= FMath::Square(Sphere.W))
+            {
+                Sources.OcclusionCacheValid[i] = false;
+                break;
+            }
+        }
+    }
+
+    PendingOcclusionInvalidations.Reset();
+}
+
+void UAcousticEngineSubsystem::UpdateStalenessStats()
+{
+    const double CurrentTime = FPlatformTime::Seconds();
+
+    for (float& Staleness : CurrentBudget.WorstOcclusionStaleness)
+    {
+        Staleness = 0.0f;
+    }
+
+    for (int32 i = 0; i < Sources.Num(); i++)
+    {
+        const EAcousticLOD LOD = Sources.EffectiveLODs[i];
+        if (LOD == EAcousticLOD::Off || !Sources.ColdData[i].CurrentParams.bIsValid)
+        {
+            continue;
+        }
+
+        float& Worst = CurrentBudget.WorstOcclusionStaleness[static_cast<int32>(LOD)];
+        Worst = FMath::Max(Worst, static_cast<float>(CurrentTime - Sources.LastOcclusionUpdateTimes[i]));
+    }
+
+    SET_FLOAT_STAT(STAT_AcousticStalenessBasic, CurrentBudget.WorstOcclusionStaleness[static_cast<int32>(EAcousticLOD::Basic)] * 1000.0f);
+    SET_FLOAT_STAT(STAT_AcousticStalenessAdvanced, CurrentBudget.WorstOcclusionStaleness[static_cast<int32>(EAcousticLOD::Advanced)] * 1000.0f);
+    SET_FLOAT_STAT(STAT_AcousticStalenessHero, CurrentBudget.WorstOcclusionStaleness[static_cast<int32>(EAcousticLOD::Hero)] * 1000.0f);
+}
+
+void UAcousticEngineSubsystem::ApplyOcclusionResult(int32 DenseIndex, const FAcousticRayHit& Hit, float Occlusion, double CurrentTime)
+{
+    FAcousticSourceColdData& Cold = Sources.ColdData[DenseIndex];
+    const FAcousticMaterial& Material = GetMaterialByIndex(Hit.MaterialIndex);
+
+    // Store previous params for interpolation
+    Cold.PreviousParams = Cold.CurrentParams;
+
+    // Update occlusion params
+    Cold.CurrentParams.Occlusion = Occlusion;
+    Cold.CurrentParams.LowPassCutoff = ComputeLPFFromOcclusion(Occlusion, Material);
+    Cold.CurrentParams.TransmissionGain = Hit.bIsValidHit ?
+        (1.0f - Occlusion) + (Occlusion * Material.Transmission) : 1.0f;
+    Cold.CurrentParams.bIsValid = true;
+
+    // A movable blocker can change without either end moving
+    Sources.OcclusionCacheValid[DenseIndex] = !Hit.bIsDynamicHit;
+    Sources.LastOcclusionUpdateTimes[DenseIndex] = CurrentTime;
+
+    UpdatePortalPath(DenseIndex, Occlusion);
+}
+
+void UAcousticEngineSubsystem::UpdatePortalPath(int32 DenseIndex, float Occlusion)
+{
+    FAcousticSourceParams& Params = Sources.ColdData[DenseIndex].CurrentParams;
+    Params.bHasPortalPath = false;
+    Params.PortalPathLength = 0.0f;
+    Params.PortalDelayMs = 0.0f;
+    Params.PortalGain = 0.0f;
+    Params.PortalLPFCutoff = AcousticConstants::DefaultLPFCutoff;
+    Params.PortalDirection = FVector::ZeroVector;
+
+    // Only sound that the direct path loses is worth routing around
+    if (!Settings->bEnablePortalPropagation || Occlusion <= 0.0f ||
+        SimulationFrame.Listeners.Num() == 0 || !SimulationFrame.ListenerZoneNodes.IsValidIndex(0))
+    {
+        return;
+    }
+
+    const FAcousticListenerData& Listener = SimulationFrame.Listeners[0];
+    const FVector& SourceLocation = Sources.Positions[DenseIndex];
+
+    FAcousticPortalPath Path;
+    if (!PortalGraph.FindPath(Sources.ZoneNodes[DenseIndex], SourceLocation, SimulationFrame.ListenerZoneNodes[0], Listener.Location, Path))
+    {
+        return;
+    }
+
+    // Distance attenuation of the longer path, relative to the direct distance the audio engine already applies
+    const float DirectDistance = FMath::Max(FVector::Dist(SourceLocation, Listener.Location), AcousticConstants::MinDistance);
+    const float DistanceRatio = FMath::Clamp(DirectDistance / FMath::Max(Path.PathLength, DirectDistance), 0.0f, 1.0f);
+
+    Params.bHasPortalPath = true;
+    Params.PortalPathLength = Path.PathLength;
+    Params.PortalDelayMs = (Path.PathLength / AcousticConstants::SpeedOfSound) * 1000.0f;
+    Params.PortalGain = FMath::Clamp(Path.Transmission * DistanceRatio, 0.0f, 1.0f);
+    Params.PortalLPFCutoff = Path.LPFCutoff;
+    Params.PortalDirection = (Path.ArrivalLocation - Listener.Location).GetSafeNormal();
+}
+
+bool UAcousticEngineSubsystem::IsZoneNodeAudible(int32 ZoneNode) const
+{
+    for (const FAcousticAudibleZoneSet& AudibleSet : SimulationFrame.AudibleZoneSets)
+    {
+        if (AudibleSet.Contains(ZoneNode))
+        {
+            return true;
+        }
+    }
+
+    // No listener zones resolved yet - nothing to cull against
+    return SimulationFrame.AudibleZoneSets.Num() == 0;
+}
+
+void UAcousticEngineSubsystem::ApplyZoneCulledResult(int32 DenseIndex, double CurrentTime)
+{
+    // Same result a full occluder of the default material would give, with no portal route
+    FAcousticRayHit Hit;
+    Hit.bIsValidHit = true;
+    ApplyOcclusionResult(DenseIndex, Hit, 1.0f, CurrentTime);
+
+    Sources.ColdData[DenseIndex].CurrentParams.EarlyReflections.Reset();
+
+    // Whatever the source sees once it is reachable again has to be traced
+    Sources.ZoneCulledFlags[DenseIndex] = true;
+    Sources.OcclusionCacheValid[DenseIndex] = false;
+    Sources.OcclusionDeficits[DenseIndex] = 0.0f;
+}
+
+void UAcousticEngineSubsystem::UpdatePortalGraph()
+{
+    const int32 NumCachedRoutes = PortalGraph.GetNumCachedRoutes();
+    bool bRoutesChanged = false;
+    bool bPortalsChanged = false;
+
+    if (bPortalGraphDirty)
+    {
+        PortalGraph.Build(RegisteredZones, RegisteredPortals, Settings->MinPortalOpenness);
+        bPortalGraphDirty = false;
+        bSourceZonesDirty = true;
+        bRoutesChanged = true;
+    }
+    else
+    {
+        for (const TWeakObjectPtr<AAcousticPortalVolume>& Portal : ChangedPortals)
+        {
+            bPortalsChanged |= PortalGraph.UpdatePortal(Portal.Get(), Settings->MinPortalOpenness);
+        }
+        bRoutesChanged = PortalGraph.GetNumCachedRoutes() < NumCachedRoutes;
+    }
+    ChangedPortals.Reset();
+
+    // Cached occlusion of routed sources carries the old route or portal gain - re-trace them when due
+    if (bRoutesChanged || bPortalsChanged)
+    {
+        for (int32 i = 0; i < Sources.Num(); i++)
+        {
+            if (Sources.ColdData[i].CurrentParams.Occlusion > 0.0f)
+            {
+                Sources.OcclusionCacheValid[i] = false;
+            }
+        }
+    }
+}
+
+void UAcousticEngineSubsystem::ProcessReflections(float DeltaTime)
+{
+    if (SimulationFrame.Listeners.Num() == 0)
+    {
+        return;
+    }
+
+    const FAcousticListenerData& Listener = SimulationFrame.Listeners[0];
+    double CurrentTime = FPlatformTime::Seconds();
+
+    // Advance the rolling sweep of the listener hemisphere; every source shares the hits
+    const int32 ProbeRays = GetProbeRayCount();
+    const FAcousticReflectionProbe* Probe = ProbeRays > 0 ? UpdateReflectionProbe(0, ProbeRays, GetProbeBounceCount(), DeltaTime) : nullptr;
+
+    const FAcousticZonePreset ZonePreset = SimulationFrame.ZonePresets.IsValidIndex(0) ?
+        SimulationFrame.ZonePresets[0] : FAcousticZonePreset();
+
+    const FAcousticBakedProbeSample* BakedProbe = SimulationFrame.ProbeSamples.IsValidIndex(0) &&
+        SimulationFrame.ProbeSamples[0].bIsValid ? &SimulationFrame.ProbeSamples[0] : nullptr;
+
+    for (const int32 i : SimulationFrame.CandidateSources)
+    {
+        const EAcousticLOD LOD = Sources.EffectiveLODs[i];
+        if (LOD == EAcousticLOD::Off || CurrentTime < Sources.NextReflectionUpdateTimes[i])
+        {
+            continue;
+        }
+
+        FAcousticSourceParams& Params = Sources.ColdData[i].CurrentParams;
+
+        // Only process Advanced and Hero LODs
+        if (LOD == EAcousticLOD::Basic)
+        {
+            // For Basic LOD, just use zone-based reverb
+            Params.ReverbSend = ZonePreset.DefaultReverbSend;
+            Params.EarlyReflections.Reset();
+        }
+        else
+        {
+            if (LOD == EAcousticLOD::Advanced && BakedProbe)
+            {
+                // Static map around the listener is baked - no rays
+                BuildBakedReflections(*BakedProbe, Listener, Sources.Positions[i], Params.EarlyReflections);
+                CurrentBudget.BakedReflectionUpdates++;
+            }
+            else if (LOD == EAcousticLOD::Hero && Probe && Probe->bIsValid)
+            {
+                FAcousticSourceColdData& Cold = Sources.ColdData[i];
+
+                // Exact specular taps from image sources first
+                TraceImageSources(*Probe, Listener, Sources.Positions[i], Cold.ImageTree, Params.EarlyReflections);
+
+                // Scattered and higher-order paths fill the remaining slots
+                if (Params.EarlyReflections.ValidTapCount < FEarlyReflectionParams::MaxTaps)
+                {
+                    FEarlyReflectionParams PathReflections;
+                    TraceReflectionPaths(*Probe, Listener, Sources.Positions[i], Cold.PathVisibility, PathReflections);
+                    MergeReflectionTaps(PathReflections, Params.EarlyReflections);
+                }
+            }
+            else if (Probe)
+            {
+                // Derive this source's taps from the shared probe hits
+                ClusterReflections(Probe->Hits, Listener, Sources.Positions[i], Params.EarlyReflections);
+            }
+            else
+            {
+                continue;
+            }
+
+            // Compute reverb send based on reflections
+            float ReflectionDensity = Params.EarlyReflections.ReflectionDensity;
+            Params.ReverbSend = FMath::Lerp(
+                ZonePreset.DefaultReverbSend,
+                ZonePreset.DefaultReverbSend * 1.5f,
+                ReflectionDensity
+            );
+        }
+
+        Sources.LastReflectionUpdateTimes[i] = CurrentTime;
+        Sources.NextReflectionUpdateTimes[i] = AcousticConstants::AdvanceDeadline(
+            Sources.NextReflectionUpdateTimes[i],
+            GetUpdateInterval(Settings->ReflectionUpdateRateHz, LOD),
+            Sources.UpdatePhases[i],
+            CurrentTime);
+    }
+}
+
+const FAcousticReflectionProbe* UAcousticEngineSubsystem::UpdateReflectionProbe(int32 ListenerIndex, int32 NumRays, int32 NumBounces, float DeltaTime)
+{
+    if (!SimulationFrame.Listeners.IsValidIndex(ListenerIndex))
+    {
+        return nullptr;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    if (ReflectionProbes.Num() < SimulationFrame.Listeners.Num())
+    {
+        ReflectionProbes.SetNum(SimulationFrame.Listeners.Num());
+    }
+
+    FAcousticReflectionProbe& Probe = ReflectionProbes[ListenerIndex];
+
+    // The listener jumped out of the region the cached hits were traced around - start over
+    const FVector& ListenerLocation = SimulationFrame.Listeners[ListenerIndex].Location;
+    const float ValidityRadius = FMath::Max(Settings->OcclusionCacheMinTolerance,
+        Settings->OcclusionCacheToleranceRatio * Settings->MaxTraceDistance);
+    if (Probe.NumRays > 0 && FVector::DistSquared(Probe.Origin, ListenerLocation) > FMath::Square(ValidityRadius))
+    {
+        ResetReflectionProbe(Probe);
+        Probe.Origin = ListenerLocation;
+    }
+
+    // Ray or bounce count changed (a Hero source came or went) - keep what was traced
+    if (Probe.NumRays != NumRays || Probe.NumBounces != NumBounces)
+    {
+        ResizeReflectionProbe(Probe, NumRays, NumBounces);
+    }
+
+    const bool bAsyncTraces = ShouldUseAsyncTraces();
+
+    // Bounces queued when last frame's results landed; a mode switch leaves those paths short until re-traced
+    if (bAsyncTraces)
+    {
+        IssueProbePathTraces(Probe);
+    }
+    else
+    {
+        Probe.PendingPathTraces.Reset();
+    }
+
+    // Previous slice still in flight
+    if (bAsyncTraces && Probe.PendingTraces.Num() > 0)
+    {
+        return Probe.Hits.Num() > 0 || Probe.bIsValid ? &Probe : nullptr;
+    }
+
+    // One full sweep per reflection interval, spread evenly over frames; each ray may extend into a full path
+    const float DesiredRays = NumRays * Settings->ReflectionUpdateRateHz * DeltaTime + Probe.SliceCarry;
+    const int32 RemainingBudget = FMath::Max(CurrentBudget.TotalRaysBudget - CurrentBudget.TotalRaysUsed, 0) / NumBounces;
+    const int32 SliceRays = FMath::Min3(FMath::FloorToInt(DesiredRays), NumRays, RemainingBudget);
+    Probe.SliceCarry = FMath::Min(DesiredRays - SliceRays, static_cast<float>(NumRays));
+
+    if (SliceRays > 0)
+    {
+        const int32 FirstRay = Probe.NextRay;
+        const FAcousticListenerData& Listener = SimulationFrame.Listeners[ListenerIndex];
+        const FQuat Rotation = FQuat::FindBetweenNormals(FVector::UpVector, Listener.Forward);
+        const FCollisionQueryParams QueryParams = MakeTraceQueryParams();
+
+        if (bAsyncTraces)
+        {
+            Probe.PendingFirstRay = Probe.NextRay;
+            Probe.PendingTraces.Reset(SliceRays);
+        }
+
+        if (ShouldUseGeometryScene())
+        {
+            // The whole slice goes to the BVH as four-ray packets
+            FAcousticRayPacket Packet;
+            FAcousticRayHit PacketHits[FAcousticRayPacket::Width];
+
+            for (int32 k = 0; k < SliceRays; k += FAcousticRayPacket::Width)
+            {
+                Packet.NumRays = FMath::Min(FAcousticRayPacket::Width, SliceRays - k);
+                for (int32 Lane = 0; Lane < Packet.NumRays; Lane++)
+                {
+                    const int32 RayIndex = (Probe.NextRay + k + Lane) % NumRays;
+                    Packet.Origins[Lane] = FVector3f(Listener.Location);
+                    Packet.Directions[Lane] = FVector3f(Rotation.RotateVector(Probe.LocalDirections[RayIndex]));
+                    Packet.MaxDistances[Lane] = Settings->MaxTraceDistance;
+                }
+
+                GeometryScene.TracePacket(Packet, PacketHits);
+
+                for (int32 Lane = 0; Lane < Packet.NumRays; Lane++)
+                {
+                    Probe.RayHits[(Probe.NextRay + k + Lane) % NumRays] = PacketHits[Lane];
+                }
+            }
+        }
+        else
+        {
+            for (int32 k = 0; k < SliceRays; k++)
+            {
+                const int32 RayIndex = (Probe.NextRay + k) % NumRays;
+                const FVector End = Listener.Location + Rotation.RotateVector(Probe.LocalDirections[RayIndex]) * Settings->MaxTraceDistance;
+
+                if (bAsyncTraces)
+                {
+                    Probe.PendingTraces.Add(World->AsyncLineTraceByChannel(
+                        EAsyncTraceType::Single,
+                        Listener.Location,
+                        End,
+                        Settings->AudioOcclusionChannel,
+                        QueryParams
+                    ));
+                    continue;
+                }
+
+                FHitResult HitResult;
+                FAcousticRayHit& RayHit = Probe.RayHits[RayIndex];
+                if (World->LineTraceSingleByChannel(HitResult, Listener.Location, End, Settings->AudioOcclusionChannel, QueryParams))
+                {
+                    FillRayHit(HitResult, RayHit);
+                }
+                else
+                {
+                    RayHit = FAcousticRayHit();
+                }
+            }
+        }
+
+        // A wrap of the cursor completes a sweep
+        const int32 NextRay = Probe.NextRay + SliceRays;
+        Probe.bIsValid |= (NextRay >= NumRays);
+        Probe.bPlanesDirty |= (NextRay >= NumRays);
+        Probe.NextRay = NextRay % NumRays;
+        Probe.Origin = Listener.Location;
+        Probe.Forward = Listener.Forward;
+        Probe.LastUpdateTime = FPlatformTime::Seconds();
+
+        CurrentBudget.ReflectionRays += SliceRays;
+        CurrentBudget.TotalRaysUsed += SliceRays;
+
+        if (!bAsyncTraces)
+        {
+            TraceProbePaths(Probe, FirstRay, SliceRays);
+            RebuildProbeHits(Probe);
+        }
+    }
+
+    return Probe.Hits.Num() > 0 || Probe.bIsValid ? &Probe : nullptr;
+}
+
+void UAcousticEngineSubsystem::ResetReflectionProbe(FAcousticReflectionProbe& Probe) const
+{
+    for (FAcousticRayHit& RayHit : Probe.RayHits)
+    {
+        RayHit = FAcousticRayHit();
+    }
+    for (FAcousticPathVertex& Vertex : Probe.PathVertices)
+    {
+        Vertex = FAcousticPathVertex();
+    }
+    FMemory::Memzero(Probe.PathGenerations.GetData(), Probe.PathGenerations.Num() * sizeof(uint32));
+
+    Probe.Hits.Reset();
+    Probe.ReflectorPlanes.Reset();
+    Probe.PlaneGeneration++;
+    Probe.PendingTraces.Reset();
+    Probe.PendingPathTraces.Reset();
+    Probe.NextRay = 0;
+    Probe.SliceCarry = 0.0f;
+    Probe.bIsValid = false;
+}
+
+void UAcousticEngineSubsystem::ResizeReflectionProbe(FAcousticReflectionProbe& Probe, int32 NumRays, int32 NumBounces) const
+{
+    const int32 OldRays = Probe.NumRays;
+    const int32 OldBounces = Probe.NumBounces;
+    const TArray<FVector> OldDirections = MoveTemp(Probe.LocalDirections);
+    const TArray<FAcousticRayHit> OldHits = MoveTemp(Probe.RayHits);
+    const TArray<FAcousticPathVertex> OldVertices = MoveTemp(Probe.PathVertices);
+
+    Probe.NumRays = NumRays;
+    Probe.NumBounces = NumBounces;
+    GenerateHemisphereRays(FVector::UpVector, NumRays, Probe.LocalDirections);
+    Probe.RayHits.SetNum(NumRays);
+    Probe.PathVertices.SetNum(NumRays * NumBounces);
+    Probe.PathGenerations.Reset();
+    Probe.PathGenerations.SetNumZeroed(NumRays);
+    Probe.NextRay = NumRays > 0 ? Probe.NextRay % NumRays : 0;
+
+    // In-flight traces were issued against the old ray layout
+    Probe.PendingTraces.Reset();
+    Probe.PendingPathTraces.Reset();
+
+    // Each ray of the smaller layout is paired with the nearest free direction of the
+    // larger one. Paired slots keep their hit and path prefix; the rest fill in as the
+    // sweep passes. Kept paths get fresh generations, since per-source visibility is
+    // cached by vertex index and the indices moved.
+    const bool bGrowing = NumRays >= OldRays;
+    const int32 NumPairs = FMath::Min(OldRays, NumRays);
+    const int32 NumKeptBounces = FMath::Min(OldBounces, NumBounces);
+    TBitArray<> Taken(false, FMath::Max(OldRays, NumRays));
+
+    for (int32 s = 0; s < NumPairs; s++)
+    {
+        const FVector& Direction = bGrowing ? OldDirections[s] : Probe.LocalDirections[s];
+        const TArray<FVector>& Others = bGrowing ? Probe.LocalDirections : OldDirections;
+
+        int32 Nearest = INDEX_NONE;
+        float NearestDot = -2.0f;
+        for (int32 o = 0; o < Others.Num(); o++)
+        {
+            const float Dot = FVector::DotProduct(Direction, Others[o]);
+            if (!Taken[o] && Dot > NearestDot)
+            {
+                Nearest = o;
+                NearestDot = Dot;
+            }
+        }
+        Taken[Nearest] = true;
+
+        const int32 OldRay = bGrowing ? s : Nearest;
+        const int32 NewRay = bGrowing ? Nearest : s;
+        Probe.RayHits[NewRay] = OldHits[OldRay];
+        if (!OldHits[OldRay].bIsValidHit)
+        {
+            continue;
+        }
+
+        Probe.PathGenerations[NewRay] = Probe.NextPathGeneration++;
+        for (int32 Bounce = 0; Bounce < NumKeptBounces; Bounce++)
+        {
+            Probe.PathVertices[NewRay * NumBounces + Bounce] = OldVertices[OldRay * OldBounces + Bounce];
+        }
+    }
+
+    RebuildProbeHits(Probe);
+}
+
+void UAcousticEngineSubsystem::TraceProbePaths(FAcousticReflectionProbe& Probe, int32 FirstRay, int32 NumPathRays)
+{
+    int32 RaysTraced = 0;
+
+    for (int32 k = 0; k < NumPathRays; k++)
+    {
+        const int32 RayIndex = (FirstRay + k) % Probe.NumRays;
+
+        FVector Start;
+        FVector Direction;
+        bool bContinue = BeginProbePath(Probe, RayIndex, Start, Direction);
+        for (int32 Bounce = 1; bContinue; Bounce++)
+        {
+            FAcousticRayHit BounceHit;
+            TraceOcclusion(Start, Start + Direction * Settings->MaxTraceDistance, BounceHit);
+            RaysTraced++;
+
+            bContinue = BounceHit.bIsValidHit &&
+                ExtendProbePath(Probe, RayIndex, Bounce, BounceHit, Direction, Start, Direction);
+        }
+    }
+
+    CurrentBudget.ReflectionRays += RaysTraced;
+    CurrentBudget.TotalRaysUsed += RaysTraced;
+}
+
+bool UAcousticEngineSubsystem::BeginProbePath(FAcousticReflectionProbe& Probe, int32 RayIndex, FVector& OutStart, FVector& OutDirection) const
+{
+    Probe.PathGenerations[RayIndex] = Probe.NextPathGeneration++;
+
+    FAcousticPathVertex* Path = &Probe.PathVertices[RayIndex * Probe.NumBounces];
+    for (int32 Bounce = 0; Bounce < Probe.NumBounces; Bounce++)
+    {
+        Path[Bounce] = FAcousticPathVertex();
+    }
+
+    const FAcousticRayHit& FirstHit = Probe.RayHits[RayIndex];
+    if (!FirstHit.bIsValidHit)
+    {
+        return false;
+    }
+
+    return ExtendProbePath(Probe, RayIndex, 0, FirstHit, (FirstHit.HitLocation - Probe.Origin).GetSafeNormal(), OutStart, OutDirection);
+}
+
+bool UAcousticEngineSubsystem::ExtendProbePath(FAcousticReflectionProbe& Probe, int32 RayIndex, int32 Bounce, const FAcousticRayHit& Hit,
+    FVector Incoming, FVector& OutStart, FVector& OutDirection) const
+{
+    FAcousticPathVertex* Path = &Probe.PathVertices[RayIndex * Probe.NumBounces];
+    const FAcousticMaterial& Material = GetMaterialByIndex(Hit.MaterialIndex);
+
+    FAcousticPathVertex& Vertex = Path[Bounce];
+    Vertex.Location = Hit.HitLocation;
+    Vertex.Normal = FVector::DotProduct(Hit.HitNormal, Incoming) > 0.0f ? -Hit.HitNormal : Hit.HitNormal;
+    Vertex.PathLength = Bounce > 0 ? Path[Bounce - 1].PathLength + AcousticConstants::PathSurfaceOffset + Hit.Distance : Hit.Distance;
+    Vertex.Energy = (Bounce > 0 ? Path[Bounce - 1].Energy : 1.0f) * (1.0f - Material.GetAverageAbsorption());
+    Vertex.HighEnergy = (Bounce > 0 ? Path[Bounce - 1].HighEnergy : 1.0f) * (1.0f - Material.HighAbsorption);
+    Vertex.bIsValid = true;
+
+    if (Bounce + 1 >= Probe.NumBounces)
+    {
+        return false;
+    }
+
+    // Scattered directions are seeded per trace and bounce, so an unchanged scene gives the same paths
+    FRandomStream Random(static_cast<int32>(HashCombineFast(Probe.PathGenerations[RayIndex], static_cast<uint32>(Bounce))));
+
+    // Mirror direction, pulled toward a cosine-weighted diffuse direction by the surface's scattering
+    const FVector Specular = Incoming.MirrorByVector(Vertex.Normal);
+    const FVector Diffuse = (Vertex.Normal + Random.GetUnitVector()).GetSafeNormal(UE_SMALL_NUMBER, Vertex.Normal);
+    OutDirection = FMath::Lerp(Specular, Diffuse, Material.Scattering).GetSafeNormal(UE_SMALL_NUMBER, Vertex.Normal);
+    OutStart = Vertex.Location + Vertex.Normal * AcousticConstants::PathSurfaceOffset;
+    return true;
+}
+
+void UAcousticEngineSubsystem::IssueProbePathTraces(FAcousticReflectionProbe& Probe)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const FCollisionQueryParams QueryParams = MakeTraceQueryParams();
+    int32 RaysIssued = 0;
+
+    for (int32 p = Probe.PendingPathTraces.Num() - 1; p >= 0; p--)
+    {
+        FAcousticPendingPathTrace& PathTrace = Probe.PendingPathTraces[p];
+        if (PathTrace.Handle.IsValid())
+        {
+            continue;
+        }
+
+        // The ray was re-traced since the bounce was queued
+        if (Probe.PathGenerations[PathTrace.RayIndex] != PathTrace.Generation)
+        {
+            Probe.PendingPathTraces.RemoveAtSwap(p, 1, EAllowShrinking::No);
+            continue;
+        }
+
+        PathTrace.Handle = World->AsyncLineTraceByChannel(
+            EAsyncTraceType::Single,
+            PathTrace.Start,
+            PathTrace.Start + PathTrace.Direction * Settings->MaxTraceDistance,
+            Settings->AudioOcclusionChannel,
+            QueryParams
+        );
+        RaysIssued++;
+    }
+
+    CurrentBudget.ReflectionRays += RaysIssued;
+    CurrentBudget.TotalRaysUsed += RaysIssued;
+}
+
+void UAcousticEngineSubsystem::RebuildProbeHits(FAcousticReflectionProbe& Probe) const
 {
-    if (ListenerDataArray.Num() == 0)
+    // Until the first sweep completes, the previous hit set is more complete
+    if (!Probe.bIsValid)
     {
         return;
     }
 
-    const FVector& ListenerLocation = ListenerDataArray[0].Location;
-    double CurrentTime = FPlatformTime::Seconds();
-
-    for (auto& Pair : RegisteredSources)
+    Probe.Hits.Reset(Probe.RayHits.Num());
+    for (const FAcousticRayHit& RayHit : Probe.RayHits)
     {
-        FAcousticSourceEntry& Entry = Pair.Value;
-
-        if (Entry.EffectiveLOD == EAcousticLOD::Off)
+        if (RayHit.bIsValidHit)
         {
-            continue;
+            Probe.Hits.Add(RayHit);
         }
+    }
 
-        // Check ray budget
-        if (CurrentBudget.TotalRaysUsed >= CurrentBudget.TotalRaysBudget)
-        {
-            break;
-        }
+    // Refit the reflectors once per sweep
+    if (Probe.bPlanesDirty)
+    {
+        ExtractReflectorPlanes(Probe);
+        Probe.bPlanesDirty = false;
+    }
+}
 
-        UAcousticSourceComponent* Source = Entry.SourceComponent.Get();
-        if (!Source)
-        {
-            continue;
-        }
+void UAcousticEngineSubsystem::ExtractReflectorPlanes(FAcousticReflectionProbe& Probe) const
+{
+    struct FPlaneCluster
+    {
+        /** First hit's plane, used to match later hits */
+        FVector SeedNormal;
+        float SeedDistance;
+
+        FVector NormalSum = FVector::ZeroVector;
+        float DistanceSum = 0.0f;
+        int32 NumHits = 0;
+    };
+
+    // Group hits into planes greedily; a probe has few enough hits for a linear search
+    TArray<FPlaneCluster, TInlineAllocator<32>> Clusters;
+    for (const FAcousticRayHit& Hit : Probe.Hits)
+    {
+        // Normals face the listener, so every image lies behind its plane
+        const FVector Normal = FVector::DotProduct(Hit.HitNormal, Probe.Origin - Hit.HitLocation) < 0.0f ? -Hit.HitNormal : Hit.HitNormal;
+        const float Distance = FVector::DotProduct(Normal, Hit.HitLocation);
 
-        // Check if we should use cached data
-        double TimeSinceUpdate = CurrentTime - Entry.LastOcclusionUpdateTime;
-        float CacheTime = Settings->OcclusionCacheFrames / 60.0f;
+        FPlaneCluster* Cluster = Clusters.FindByPredicate([&Normal, Distance](const FPlaneCluster& Candidate) {
+            return FVector::DotProduct(Candidate.SeedNormal, Normal) >= AcousticConstants::ReflectorPlaneNormalDot &&
+                FMath::Abs(Candidate.SeedDistance - Distance) <= AcousticConstants::ReflectorPlaneTolerance;
+        });
 
-        if (TimeSinceUpdate < CacheTime && Entry.CurrentParams.bIsValid)
+        if (!Cluster)
         {
-            continue; // Use cached data
+            Cluster = &Clusters.AddDefaulted_GetRef();
+            Cluster->SeedNormal = Normal;
+            Cluster->SeedDistance = Distance;
         }
 
-        // Trace occlusion
-        FVector SourceLocation = Source->GetAcousticLocation();
-        FAcousticRayHit OcclusionHit;
-        float Occlusion = TraceOcclusion(ListenerLocation, SourceLocation, OcclusionHit);
+        Cluster->NormalSum += Normal;
+        Cluster->DistanceSum += Distance;
+        Cluster->NumHits++;
+    }
 
-        // Store previous params for interpolation
-        Entry.PreviousParams = Entry.CurrentParams;
+    Clusters.Sort([](const FPlaneCluster& A, const FPlaneCluster& B) {
+        return A.NumHits > B.NumHits;
+    });
 
-        // Update occlusion params
-        Entry.CurrentParams.Occlusion = Occlusion;
-        Entry.CurrentParams.LowPassCutoff = ComputeLPFFromOcclusion(Occlusion, OcclusionHit.Material);
-        Entry.CurrentParams.TransmissionGain = OcclusionHit.bIsValidHit ?
-            (1.0f - Occlusion) + (Occlusion * OcclusionHit.Material.Transmission) : 1.0f;
-        Entry.CurrentParams.bIsValid = true;
+    TArray<FAcousticReflectorPlane> Planes;
+    for (const FPlaneCluster& Cluster : Clusters)
+    {
+        if (Planes.Num() == AcousticConstants::MaxReflectorPlanes || Cluster.NumHits < AcousticConstants::MinReflectorPlaneHits)
+        {
+            break;
+        }
 
-        Entry.LastOcclusionUpdateTime = CurrentTime;
-        CurrentBudget.OcclusionRays++;
-        CurrentBudget.TotalRaysUsed++;
+        FAcousticReflectorPlane& Reflector = Planes.AddDefaulted_GetRef();
+        Reflector.Plane = FPlane(Cluster.NormalSum.GetSafeNormal(), Cluster.DistanceSum / Cluster.NumHits);
+        Reflector.NumHits = Cluster.NumHits;
     }
-}
 
-void UAcousticEngineSubsystem::ProcessReflections(float DeltaTime)
-{
-    if (ListenerDataArray.Num() == 0)
+    // Same room - keep the old planes so every source's image tree stays valid
+    bool bChanged = Planes.Num() != Probe.ReflectorPlanes.Num();
+    for (int32 i = 0; i < Planes.Num() && !bChanged; i++)
     {
-        return;
+        const FPlane& Plane = Planes[i].Plane;
+        bChanged = !Probe.ReflectorPlanes.ContainsByPredicate([&Plane](const FAcousticReflectorPlane& Old) {
+            return FVector::DotProduct(Old.Plane.GetNormal(), Plane.GetNormal()) >= AcousticConstants::ReflectorPlaneNormalDot &&
+                FMath::Abs(Old.Plane.W - Plane.W) <= AcousticConstants::ReflectorPlaneTolerance;
+        });
     }
 
-    const FAcousticListenerData& Listener = ListenerDataArray[0];
-    double CurrentTime = FPlatformTime::Seconds();
+    if (bChanged)
+    {
+        Probe.ReflectorPlanes = MoveTemp(Planes);
+        Probe.PlaneGeneration++;
+    }
+}
+
+void UAcousticEngineSubsystem::RefreshListenerZoneCache()
+{
+    const int32 NumListeners = ListenerDataArray.Num();
+    ListenerZones.SetNum(NumListeners);
+    ListenerZonePresets.SetNum(NumListeners);
+    ListenerProbeSamples.SetNum(NumListeners);
 
-    for (auto& Pair : RegisteredSources)
+    for (int32 i = 0; i < NumListeners; i++)
     {
-        FAcousticSourceEntry& Entry = Pair.Value;
+        AAcousticZoneVolume* Zone = GetZoneAtLocation(ListenerDataArray[i].Location);
+        ListenerZones[i] = Zone;
 
-        // Only process Advanced and Hero LODs
-        if (Entry.EffectiveLOD != EAcousticLOD::Advanced && Entry.EffectiveLOD != EAcousticLOD::Hero)
+        if (Zone)
         {
-            // For Basic LOD, just use zone-based reverb
-            if (Entry.EffectiveLOD == EAcousticLOD::Basic)
-            {
-                FAcousticZonePreset ZonePreset = GetCurrentZonePreset(0);
-                Entry.CurrentParams.ReverbSend = ZonePreset.DefaultReverbSend;
-                Entry.CurrentParams.EarlyReflections.Reset();
-            }
-            continue;
+            ListenerZonePresets[i] = Zone->GetCachedZonePreset();
         }
-
-        // Check ray budget
-        int32 NumRays = (Entry.EffectiveLOD == EAcousticLOD::Hero) ?
-            Settings->HeroReflectionRays : Settings->AdvancedReflectionRays;
-
-        if (CurrentBudget.TotalRaysUsed + NumRays > CurrentBudget.TotalRaysBudget)
+        else
         {
-            continue;
+            ListenerZonePresets[i] = FAcousticZonePreset();
+            ListenerZonePresets[i].PresetName = FName("Default");
+            ListenerZonePresets[i].ZoneType = EAcousticZoneType::Default;
         }
 
-        UAcousticSourceComponent* Source = Entry.SourceComponent.Get();
-        if (!Source)
+        // Baked probes refine the zone's decay times with what the geometry actually does
+        FAcousticBakedProbeSample& ProbeSample = ListenerProbeSamples[i];
+        if (Settings->bUseBakedReflections && SampleBakedProbes(ListenerDataArray[i].Location, ProbeSample))
         {
-            continue;
+            FAcousticZonePreset& Preset = ListenerZonePresets[i];
+            const float Blend = Settings->BakedReverbBlend;
+            Preset.RT60 = FMath::Lerp(Preset.RT60, ProbeSample.RT60, Blend);
+            Preset.HFDecay = FMath::Lerp(Preset.HFDecay, ProbeSample.HFDecay, Blend);
+            Preset.LFDecay = FMath::Lerp(Preset.LFDecay, ProbeSample.LFDecay, Blend);
+        }
+        else
+        {
+            ProbeSample.bIsValid = false;
         }
-
-        // Sample reflections from listener position
-        TArray<FAcousticRayHit> ReflectionHits;
-        SampleReflections(Listener.Location, Listener.Forward, NumRays, ReflectionHits);
-
-        // Cluster reflections into taps
-        ClusterReflections(ReflectionHits, Entry.CurrentParams.EarlyReflections);
-
-        // Compute reverb send based on reflections
-        float ReflectionDensity = Entry.CurrentParams.EarlyReflections.ReflectionDensity;
-        FAcousticZonePreset ZonePreset = GetCurrentZonePreset(0);
-        Entry.CurrentParams.ReverbSend = FMath::Lerp(
-            ZonePreset.DefaultReverbSend,
-            ZonePreset.DefaultReverbSend * 1.5f,
-            ReflectionDensity
-        );
-
-        Entry.LastReflectionUpdateTime = CurrentTime;
-        CurrentBudget.ReflectionRays += NumRays;
-        CurrentBudget.TotalRaysUsed += NumRays;
     }
+
+    ListenerZoneCacheFrame = GFrameCounter;
 }
 
 void UAcousticEngineSubsystem::UpdateListenerZones()
@@ -791,7 +2633,8 @@ void UAcousticEngineSubsystem::UpdateListenerZones()
     for (int32 i = 0; i < ListenerDataArray.Num(); i++)
     {
         FAcousticListenerData& Listener = ListenerDataArray[i];
-        AAcousticZoneVolume* CurrentZone = GetZoneAtLocation(Listener.Location);
+        AAcousticZoneVolume* CurrentZone = ListenerZones.IsValidIndex(i) ?
+            ListenerZones[i].Get() : GetZoneAtLocation(Listener.Location);
         int32 NewZoneId = CurrentZone ? CurrentZone->GetZoneId() : -1;
 
         if (NewZoneId != Listener.CurrentZoneId)
@@ -810,20 +2653,102 @@ void UAcousticEngineSubsystem::UpdateListenerZones()
 
 void UAcousticEngineSubsystem::ApplyParamsToSources()
 {
-    for (auto& Pair : RegisteredSources)
+    const bool bBroadcastPerSource = OnAcousticParamsUpdated.IsBound();
+    const bool bBroadcastBatch = OnAcousticParamsBatchUpdated.IsBound();
+    ParamChangeBatch.Reset();
+
+    for (int32 i = 0; i < Sources.Num(); i++)
+    {
+        FAcousticSourceColdData& Cold = Sources.ColdData[i];
+        const FAcousticSourceParams& Params = Cold.CurrentParams;
+        if (!Params.bIsValid || !HasSignificantParamChange(Cold.AppliedParams, Params))
+        {
+            continue;
+        }
+
+        UAcousticSourceComponent* Source = Sources.Components[i].Get();
+        if (!Source)
+        {
+            continue;
+        }
+
+        Cold.AppliedParams = Params;
+        Source->OnParamsUpdated(Params);
+
+        if (bBroadcastPerSource)
+        {
+            OnAcousticParamsUpdated.Broadcast(Sources.SourceIds[i], Params);
+        }
+
+        if (bBroadcastBatch)
+        {
+            FAcousticParamsChange& Change = ParamChangeBatch.AddDefaulted_GetRef();
+            Change.SourceId = Sources.SourceIds[i];
+            Change.Params = Params;
+        }
+    }
+
+    if (ParamChangeBatch.Num() > 0)
+    {
+        OnAcousticParamsBatchUpdated.Broadcast(ParamChangeBatch);
+    }
+}
+
+bool UAcousticEngineSubsystem::HasSignificantParamChange(const FAcousticSourceParams& Applied, const FAcousticSourceParams& Current) const
+{
+    if (Applied.bIsValid != Current.bIsValid)
+    {
+        return true;
+    }
+
+    // Cutoffs are compared relative to their value - a few Hz matter at 500 Hz, not at 18 kHz
+    auto CutoffChanged = [this](float A, float B)
+    {
+        return FMath::Abs(A - B) > Settings->FilterCutoffChangeRatio * FMath::Max(A, 1.0f);
+    };
+
+    if (FMath::Abs(Applied.Occlusion - Current.Occlusion) > Settings->OcclusionChangeThreshold ||
+        CutoffChanged(Applied.LowPassCutoff, Current.LowPassCutoff) ||
+        CutoffChanged(Applied.HighPassCutoff, Current.HighPassCutoff) ||
+        FMath::Abs(Applied.TransmissionGain - Current.TransmissionGain) > Settings->GainChangeThreshold ||
+        Applied.bHasPortalPath != Current.bHasPortalPath ||
+        FMath::Abs(Applied.PortalGain - Current.PortalGain) > Settings->GainChangeThreshold ||
+        FMath::Abs(Applied.PortalDelayMs - Current.PortalDelayMs) > Settings->ReflectionDelayChangeThresholdMs ||
+        CutoffChanged(Applied.PortalLPFCutoff, Current.PortalLPFCutoff) ||
+        FMath::Abs(Applied.DryGain - Current.DryGain) > Settings->GainChangeThreshold ||
+        FMath::Abs(Applied.ReverbSend - Current.ReverbSend) > Settings->ReverbSendChangeThreshold ||
+        FMath::Abs(Applied.SpatialWidth - Current.SpatialWidth) > Settings->SpatialWidthChangeThreshold ||
+        FMath::Abs(Applied.HRTFSpreadMultiplier - Current.HRTFSpreadMultiplier) > Settings->SpatialWidthChangeThreshold ||
+        FMath::Abs(Applied.Distance - Current.Distance) > Settings->DistanceChangeThreshold ||
+        FMath::Abs(Applied.PerceivedDistance - Current.PerceivedDistance) > Settings->DistanceChangeThreshold)
+    {
+        return true;
+    }
+
+    const FEarlyReflectionParams& AppliedER = Applied.EarlyReflections;
+    const FEarlyReflectionParams& CurrentER = Current.EarlyReflections;
+    if (AppliedER.ValidTapCount != CurrentER.ValidTapCount)
     {
-        FAcousticSourceEntry& Entry = Pair.Value;
-        UAcousticSourceComponent* Source = Entry.SourceComponent.Get();
+        return true;
+    }
 
-        if (Source && Entry.CurrentParams.bIsValid)
+    for (int32 i = 0; i < CurrentER.ValidTapCount; i++)
+    {
+        const FReflectionTap& A = AppliedER.Taps[i];
+        const FReflectionTap& B = CurrentER.Taps[i];
+        if (FMath::Abs(A.DelayMs - B.DelayMs) > Settings->ReflectionDelayChangeThresholdMs ||
+            FMath::Abs(A.Gain - B.Gain) > Settings->GainChangeThreshold ||
+            CutoffChanged(A.LPFCutoff, B.LPFCutoff))
         {
-            Source->OnParamsUpdated(Entry.CurrentParams);
-            OnAcousticParamsUpdated.Broadcast(Pair.Key, Entry.CurrentParams);
+            return true;
         }
     }
+
+    return false;
 }
 
-void UAcousticEngineSubsystem::ClusterReflections(const TArray<FAcousticRayHit>& Hits, FEarlyReflectionParams& OutParams)
+void UAcousticEngineSubsystem::ClusterReflections(const TArray<FAcousticRayHit>& Hits, const FAcousticListenerData& Listener,
+    const FVector& SourceLocation, FEarlyReflectionParams& OutParams)
 {
     OutParams.Reset();
 
@@ -832,52 +2757,394 @@ void UAcousticEngineSubsystem::ClusterReflections(const TArray<FAcousticRayHit>&
         return;
     }
 
-    // Sort hits by distance
-    TArray<FAcousticRayHit> SortedHits = Hits;
-    SortedHits.Sort([](const FAcousticRayHit& A, const FAcousticRayHit& B) {
-        return A.Distance < B.Distance;
+    // Path length for this source: source -> reflector -> listener
+    TArray<TPair<float, int32>, TInlineAllocator<64>> SortedPaths;
+    SortedPaths.Reserve(Hits.Num());
+    for (int32 i = 0; i < Hits.Num(); i++)
+    {
+        const FAcousticRayHit& Hit = Hits[i];
+        float PathLength = Hit.Distance + FVector::Dist(SourceLocation, Hit.HitLocation);
+        SortedPaths.Add(TPair<float, int32>(PathLength, i));
+    }
+
+    // Sort by path length
+    SortedPaths.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) {
+        return A.Key < B.Key;
     });
 
     // Calculate density
     OutParams.ReflectionDensity = FMath::Clamp(Hits.Num() / 20.0f, 0.0f, 1.0f);
 
     // Create up to 8 taps from the hits
-    int32 NumTaps = FMath::Min(SortedHits.Num(), FEarlyReflectionParams::MaxTaps);
+    int32 NumTaps = FMath::Min(SortedPaths.Num(), FEarlyReflectionParams::MaxTaps);
     float TotalDelay = 0.0f;
 
     for (int32 i = 0; i < NumTaps; i++)
     {
-        const FAcousticRayHit& Hit = SortedHits[i];
+        const FAcousticRayHit& Hit = Hits[SortedPaths[i].Value];
+        const FAcousticMaterial& Material = GetMaterialByIndex(Hit.MaterialIndex);
         FReflectionTap& Tap = OutParams.Taps[i];
 
-        // Calculate delay from path length
-        Tap.DelayMs = (Hit.Distance / AcousticConstants::SpeedOfSound) * 1000.0f;
+        FillReflectionTap(Tap, SortedPaths[i].Key, Hit.HitLocation,
+            Material.GetAverageAbsorption(), Material.HighAbsorption, Listener);
         TotalDelay += Tap.DelayMs;
+    }
+
+    OutParams.ValidTapCount = NumTaps;
+    OutParams.AverageDelayMs = NumTaps > 0 ? TotalDelay / NumTaps : 0.0f;
+}
+
+void UAcousticEngineSubsystem::BuildImageTree(const FAcousticReflectionProbe& Probe, const FVector& SourceLocation,
+    int32 MaxOrder, FAcousticImageTree& OutTree) const
+{
+    OutTree.PlaneGeneration = Probe.PlaneGeneration;
+    OutTree.SourceLocation = SourceLocation;
+    OutTree.MaxOrder = MaxOrder;
+    OutTree.Images.Reset();
 
-        // Calculate gain based on distance and material
-        float DistanceAtten = 1.0f / FMath::Max(Hit.Distance / 100.0f, 1.0f);
-        float MaterialAtten = 1.0f - Hit.Material.GetAverageAbsorption();
-        Tap.Gain = FMath::Clamp(DistanceAtten * MaterialAtten * 0.5f, 0.0f, 1.0f);
+    // Each order mirrors the previous order's images across every other plane they face
+    int32 FirstParent = INDEX_NONE;
+    int32 NumParents = 1;
 
-        // Calculate LPF from material
-        Tap.LPFCutoff = FMath::Lerp(
-            AcousticConstants::DefaultLPFCutoff,
-            3000.0f,
-            Hit.Material.HighAbsorption
-        );
+    for (int32 Order = 1; Order <= MaxOrder; Order++)
+    {
+        const int32 FirstImage = OutTree.Images.Num();
+
+        for (int32 ParentIndex = FirstParent; ParentIndex < FirstParent + NumParents; ParentIndex++)
+        {
+            const bool bHasParent = ParentIndex != INDEX_NONE;
+            const FVector Location = bHasParent ? OutTree.Images[ParentIndex].Location : SourceLocation;
+            const int32 ParentPlane = bHasParent ? OutTree.Images[ParentIndex].Plane : INDEX_NONE;
+
+            for (int32 PlaneIndex = 0; PlaneIndex < Probe.ReflectorPlanes.Num(); PlaneIndex++)
+            {
+                const FPlane& Plane = Probe.ReflectorPlanes[PlaneIndex].Plane;
+                const float Side = Plane.PlaneDot(Location);
+
+                // A plane only reflects what is in front of it
+                if (PlaneIndex == ParentPlane || Side <= 0.0f)
+                {
+                    continue;
+                }
+
+                FAcousticImageSource& Image = OutTree.Images.AddDefaulted_GetRef();
+                Image.Location = Location - Plane.GetNormal() * (2.0f * Side);
+                Image.Plane = PlaneIndex;
+                Image.Parent = ParentIndex;
+                Image.Order = Order;
+            }
+        }
+
+        FirstParent = FirstImage;
+        NumParents = OutTree.Images.Num() - FirstImage;
+        if (NumParents == 0)
+        {
+            break;
+        }
+    }
+}
+
+void UAcousticEngineSubsystem::TraceImageSources(const FAcousticReflectionProbe& Probe, const FAcousticListenerData& Listener,
+    const FVector& SourceLocation, FAcousticImageTree& Tree, FEarlyReflectionParams& OutParams)
+{
+    OutParams.Reset();
+
+    // Images only move with the source or the room
+    const int32 MaxOrder = FMath::Clamp(Settings->MaxBounces, 1, AcousticConstants::MaxImageOrder);
+    if (Tree.PlaneGeneration != Probe.PlaneGeneration || Tree.MaxOrder != MaxOrder ||
+        FVector::DistSquared(Tree.SourceLocation, SourceLocation) > FMath::Square(AcousticConstants::MinDistance))
+    {
+        BuildImageTree(Probe, SourceLocation, MaxOrder, Tree);
+    }
+
+    // The distance to an image is the exact length of its specular path
+    TArray<TPair<float, int32>, TInlineAllocator<64>> SortedPaths;
+    SortedPaths.Reserve(Tree.Images.Num());
+    for (int32 i = 0; i < Tree.Images.Num(); i++)
+    {
+        SortedPaths.Add(TPair<float, int32>(FVector::Dist(Listener.Location, Tree.Images[i].Location), i));
+    }
+
+    SortedPaths.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) {
+        return A.Key < B.Key;
+    });
+
+    const int32 MaxCandidates = FMath::Min(SortedPaths.Num(), FEarlyReflectionParams::MaxTaps * AcousticConstants::PathCandidatesPerTap);
+    int32 NumTaps = 0;
+    float TotalDelay = 0.0f;
+
+    for (int32 c = 0; c < MaxCandidates && NumTaps < FEarlyReflectionParams::MaxTaps; c++)
+    {
+        if (CurrentBudget.TotalRaysUsed >= CurrentBudget.TotalRaysBudget)
+        {
+            break;
+        }
+
+        FVector ArrivalPoint;
+        float Energy = 1.0f;
+        float HighEnergy = 1.0f;
+        if (!ValidateImagePath(Probe, Tree, SortedPaths[c].Value, Listener.Location, SourceLocation, ArrivalPoint, Energy, HighEnergy))
+        {
+            continue;
+        }
+
+        FReflectionTap& Tap = OutParams.Taps[NumTaps++];
+        FillReflectionTap(Tap, SortedPaths[c].Key, ArrivalPoint, 1.0f - Energy, 1.0f - HighEnergy, Listener);
+        TotalDelay += Tap.DelayMs;
+    }
+
+    OutParams.ValidTapCount = NumTaps;
+    OutParams.AverageDelayMs = NumTaps > 0 ? TotalDelay / NumTaps : 0.0f;
+    OutParams.ReflectionDensity = static_cast<float>(NumTaps) / FEarlyReflectionParams::MaxTaps;
+}
+
+bool UAcousticEngineSubsystem::ValidateImagePath(const FAcousticReflectionProbe& Probe, const FAcousticImageTree& Tree, int32 ImageIndex,
+    const FVector& ListenerLocation, const FVector& SourceLocation, FVector& OutArrivalPoint, float& OutEnergy, float& OutHighEnergy)
+{
+    // Unfold from the listener: each leg aims at the current image and reflects off its plane
+    FVector From = ListenerLocation;
+    int32 RaysTraced = 0;
+    bool bValid = true;
+
+    for (int32 Index = ImageIndex; Index != INDEX_NONE && bValid; Index = Tree.Images[Index].Parent)
+    {
+        const FAcousticImageSource& Image = Tree.Images[Index];
+        const FPlane& Plane = Probe.ReflectorPlanes[Image.Plane].Plane;
+        const float FromSide = Plane.PlaneDot(From);
+        const float ImageSide = Plane.PlaneDot(Image.Location);
+
+        if (FromSide <= 0.0f || ImageSide >= 0.0f)
+        {
+            bValid = false;
+            break;
+        }
+
+        const FVector Point = From + (Image.Location - From) * (FromSide / (FromSide - ImageSide));
+
+        // The leg has to land on a real surface at the reflection point, which also proves it is unobstructed
+        FAcousticRayHit Hit;
+        TraceOcclusion(From, Point - Plane.GetNormal() * AcousticConstants::ReflectorPlaneTolerance, Hit);
+        RaysTraced++;
+
+        if (!Hit.bIsValidHit || FVector::DistSquared(Hit.HitLocation, Point) > FMath::Square(AcousticConstants::ReflectorPlaneTolerance))
+        {
+            bValid = false;
+            break;
+        }
+
+        if (Index == ImageIndex)
+        {
+            OutArrivalPoint = Point;
+        }
+
+        const FAcousticMaterial& Material = GetMaterialByIndex(Hit.MaterialIndex);
+        OutEnergy *= 1.0f - Material.GetAverageAbsorption();
+        OutHighEnergy *= 1.0f - Material.HighAbsorption;
+
+        From = Point + Plane.GetNormal() * AcousticConstants::PathSurfaceOffset;
+    }
+
+    // Last leg: from the final reflection to the source itself
+    if (bValid)
+    {
+        FAcousticRayHit Hit;
+        TraceOcclusion(From, SourceLocation, Hit);
+        RaysTraced++;
+        bValid = !Hit.bIsValidHit;
+    }
+
+    CurrentBudget.ReflectionRays += RaysTraced;
+    CurrentBudget.TotalRaysUsed += RaysTraced;
+    return bValid;
+}
+
+void UAcousticEngineSubsystem::MergeReflectionTaps(const FEarlyReflectionParams& Extra, FEarlyReflectionParams& InOut) const
+{
+    for (int32 i = 0; i < Extra.ValidTapCount && InOut.ValidTapCount < FEarlyReflectionParams::MaxTaps; i++)
+    {
+        const FReflectionTap& Tap = Extra.Taps[i];
+        const bool bDuplicate = MakeArrayView(InOut.Taps.GetData(), InOut.ValidTapCount).ContainsByPredicate([&Tap](const FReflectionTap& Existing) {
+            return FMath::Abs(Existing.DelayMs - Tap.DelayMs) < AcousticConstants::MinTapSeparationMs;
+        });
+
+        if (!bDuplicate)
+        {
+            InOut.Taps[InOut.ValidTapCount++] = Tap;
+        }
+    }
+
+    TArrayView<FReflectionTap> ValidTaps = MakeArrayView(InOut.Taps.GetData(), InOut.ValidTapCount);
+    ValidTaps.Sort([](const FReflectionTap& A, const FReflectionTap& B) {
+        return A.DelayMs < B.DelayMs;
+    });
+
+    float TotalDelay = 0.0f;
+    for (const FReflectionTap& Tap : ValidTaps)
+    {
+        TotalDelay += Tap.DelayMs;
+    }
+
+    InOut.AverageDelayMs = InOut.ValidTapCount > 0 ? TotalDelay / InOut.ValidTapCount : 0.0f;
+    InOut.ReflectionDensity = FMath::Max(InOut.ReflectionDensity, Extra.ReflectionDensity);
+}
+
+void UAcousticEngineSubsystem::TraceReflectionPaths(const FAcousticReflectionProbe& Probe, const FAcousticListenerData& Listener,
+    const FVector& SourceLocation, TArray<FAcousticPathVisibility>& Visibility, FEarlyReflectionParams& OutParams)
+{
+    OutParams.Reset();
+
+    // Probe was regrown - nothing cached for this source applies any more
+    if (Visibility.Num() != Probe.PathVertices.Num())
+    {
+        Visibility.Reset();
+        Visibility.SetNum(Probe.PathVertices.Num());
+    }
+
+    // Every path vertex is a candidate: listener -> ... -> vertex -> source
+    TArray<TPair<float, int32>, TInlineAllocator<64>> SortedPaths;
+    SortedPaths.Reserve(Probe.PathVertices.Num());
+    for (int32 v = 0; v < Probe.PathVertices.Num(); v++)
+    {
+        const FAcousticPathVertex& Vertex = Probe.PathVertices[v];
+        const FVector ToSource = SourceLocation - Vertex.Location;
+
+        // The source has to be in front of the last reflecting surface
+        if (Vertex.bIsValid && FVector::DotProduct(ToSource, Vertex.Normal) > 0.0f)
+        {
+            SortedPaths.Add(TPair<float, int32>(Vertex.PathLength + ToSource.Size(), v));
+        }
+    }
+
+    SortedPaths.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) {
+        return A.Key < B.Key;
+    });
+
+    // Shortest paths first; the last leg is only re-traced when the path or the source changed
+    const int32 MaxCandidates = FMath::Min(SortedPaths.Num(), FEarlyReflectionParams::MaxTaps * AcousticConstants::PathCandidatesPerTap);
+    int32 NumTested = 0;
+    int32 NumVisible = 0;
+    int32 NumTaps = 0;
+    float TotalDelay = 0.0f;
+
+    for (int32 c = 0; c < MaxCandidates && NumTaps < FEarlyReflectionParams::MaxTaps; c++)
+    {
+        const float PathLength = SortedPaths[c].Key;
+        const int32 VertexIndex = SortedPaths[c].Value;
+        const FAcousticPathVertex& Vertex = Probe.PathVertices[VertexIndex];
+        const uint32 Generation = Probe.PathGenerations[VertexIndex / Probe.NumBounces];
+        FAcousticPathVisibility& Cached = Visibility[VertexIndex];
+
+        const float Tolerance = FMath::Max(Settings->OcclusionCacheMinTolerance,
+            Settings->OcclusionCacheToleranceRatio * (PathLength - Vertex.PathLength));
+        const bool bCacheValid = Settings->bEnableOcclusionCache && Cached.Generation == Generation &&
+            FVector::DistSquared(Cached.SourceLocation, SourceLocation) <= FMath::Square(Tolerance);
+
+        if (!bCacheValid)
+        {
+            if (CurrentBudget.TotalRaysUsed < CurrentBudget.TotalRaysBudget)
+            {
+                FAcousticRayHit Hit;
+                TraceOcclusion(Vertex.Location + Vertex.Normal * AcousticConstants::PathSurfaceOffset, SourceLocation, Hit);
+                CurrentBudget.ReflectionRays++;
+                CurrentBudget.TotalRaysUsed++;
+
+                Cached.Generation = Generation;
+                Cached.SourceLocation = SourceLocation;
+                Cached.bVisible = !Hit.bIsValidHit;
+            }
+            else if (Cached.Generation != Generation)
+            {
+                // Out of rays and never tested against this path
+                continue;
+            }
+        }
+
+        NumTested++;
+        if (!Cached.bVisible)
+        {
+            continue;
+        }
+        NumVisible++;
 
-        // Calculate direction for spatial positioning (simplified)
-        // In a full implementation, this would compute azimuth/elevation from hit location
-        Tap.Azimuth = 0.0f;
-        Tap.Elevation = 0.0f;
+        // The first vertex of the path sets the arrival direction at the listener
+        const FAcousticPathVertex& FirstVertex = Probe.PathVertices[VertexIndex - VertexIndex % Probe.NumBounces];
+        FReflectionTap& Tap = OutParams.Taps[NumTaps++];
 
-        Tap.bIsValid = true;
+        FillReflectionTap(Tap, PathLength, FirstVertex.Location,
+            1.0f - Vertex.Energy, 1.0f - Vertex.HighEnergy, Listener);
+        TotalDelay += Tap.DelayMs;
     }
 
+    // Density from the candidates, scaled by the share that proved visible
+    const float VisibleRatio = NumTested > 0 ? static_cast<float>(NumVisible) / NumTested : 0.0f;
+    OutParams.ReflectionDensity = FMath::Clamp(SortedPaths.Num() * VisibleRatio / 20.0f, 0.0f, 1.0f);
     OutParams.ValidTapCount = NumTaps;
     OutParams.AverageDelayMs = NumTaps > 0 ? TotalDelay / NumTaps : 0.0f;
 }
 
+void UAcousticEngineSubsystem::BuildBakedReflections(const FAcousticBakedProbeSample& Sample, const FAcousticListenerData& Listener,
+    const FVector& SourceLocation, FEarlyReflectionParams& OutParams) const
+{
+    OutParams.Reset();
+    OutParams.ReflectionDensity = Sample.ReflectionDensity;
+
+    // Reflectors are placed around the listener; the path to this source sets the order
+    TArray<TPair<float, int32>, TInlineAllocator<FEarlyReflectionParams::MaxTaps>> SortedPaths;
+    for (int32 i = 0; i < Sample.NumTaps; i++)
+    {
+        const FAcousticBakedProbeSample::FTap& Tap = Sample.Taps[i];
+        const FVector Reflector = Listener.Location + Tap.Direction * Tap.Distance;
+        SortedPaths.Add(TPair<float, int32>(Tap.Distance + FVector::Dist(SourceLocation, Reflector), i));
+    }
+
+    SortedPaths.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) {
+        return A.Key < B.Key;
+    });
+
+    float TotalDelay = 0.0f;
+    for (int32 i = 0; i < SortedPaths.Num(); i++)
+    {
+        const FAcousticBakedProbeSample::FTap& BakedTap = Sample.Taps[SortedPaths[i].Value];
+        FReflectionTap& Tap = OutParams.Taps[i];
+
+        FillReflectionTap(Tap, SortedPaths[i].Key, Listener.Location + BakedTap.Direction * BakedTap.Distance,
+            BakedTap.AverageAbsorption, BakedTap.HighAbsorption, Listener);
+        TotalDelay += Tap.DelayMs;
+    }
+
+    OutParams.ValidTapCount = SortedPaths.Num();
+    OutParams.AverageDelayMs = SortedPaths.Num() > 0 ? TotalDelay / SortedPaths.Num() : 0.0f;
+}
+
+void UAcousticEngineSubsystem::FillReflectionTap(FReflectionTap& Tap, float PathLength, const FVector& ReflectorLocation,
+    float AverageAbsorption, float HighAbsorption, const FAcousticListenerData& Listener) const
+{
+    // Calculate delay from path length
+    Tap.DelayMs = (PathLength / AcousticConstants::SpeedOfSound) * 1000.0f;
+
+    // Calculate gain based on distance and material
+    float DistanceAtten = 1.0f / FMath::Max(PathLength / 100.0f, 1.0f);
+    float MaterialAtten = 1.0f - AverageAbsorption;
+    Tap.Gain = FMath::Clamp(DistanceAtten * MaterialAtten * 0.5f, 0.0f, 1.0f);
+
+    // Calculate LPF from material
+    Tap.LPFCutoff = FMath::Lerp(
+        AcousticConstants::DefaultLPFCutoff,
+        3000.0f,
+        HighAbsorption
+    );
+
+    // Arrival direction relative to the listener's orientation
+    FVector ToReflector = (ReflectorLocation - Listener.Location).GetSafeNormal();
+    float Forward = FVector::DotProduct(ToReflector, Listener.Forward);
+    float Right = FVector::DotProduct(ToReflector, Listener.Right);
+    float Up = FVector::DotProduct(ToReflector, Listener.Up);
+    Tap.Azimuth = FMath::RadiansToDegrees(FMath::Atan2(Right, Forward));
+    Tap.Elevation = FMath::RadiansToDegrees(FMath::Asin(FMath::Clamp(Up, -1.0f, 1.0f)));
+
+    Tap.bIsValid = true;
+}
+
 float UAcousticEngineSubsystem::ComputeOcclusionFactor(const FAcousticRayHit& Hit) const
 {
     if (!Hit.bIsValidHit)
@@ -886,7 +3153,7 @@ float UAcousticEngineSubsystem::ComputeOcclusionFactor(const FAcousticRayHit& Hi
     }
 
     // Base occlusion from transmission (0 transmission = full occlusion)
-    float BaseOcclusion = 1.0f - Hit.Material.Transmission;
+    float BaseOcclusion = 1.0f - GetMaterialByIndex(Hit.MaterialIndex).Transmission;
 
     // Apply realism factor
     float RealismFactor = Settings ? Settings->RealismFactor : 0.7f;
@@ -956,22 +3223,23 @@ void UAcousticEngineSubsystem::DrawDebugVisualization()
     }
 
     // Draw source positions
-    for (const auto& Pair : RegisteredSources)
+    for (int32 i = 0; i < Sources.Num(); i++)
     {
-        const FAcousticSourceEntry& Entry = Pair.Value;
-        if (UAcousticSourceComponent* Source = Entry.SourceComponent.Get())
+        if (!Sources.Components[i].IsValid())
         {
-            FVector Location = Source->GetAcousticLocation();
-            FColor Color = Entry.bIsAudible ? FColor::Yellow : FColor::Red;
+            continue;
+        }
 
-            DrawDebugSphere(World, Location, 15.0f, 6, Color, false, -1.0f);
+        const FVector& Location = Sources.Positions[i];
+        FColor Color = Sources.AudibleFlags[i] ? FColor::Yellow : FColor::Red;
 
-            // Draw occlusion line
-            if (Settings->bDrawOcclusionRays && ListenerDataArray.Num() > 0)
-            {
-                FColor OcclusionColor = FColor::MakeRedToGreenColorFromScalar(1.0f - Entry.CurrentParams.Occlusion);
-                DrawDebugLine(World, ListenerDataArray[0].Location, Location, OcclusionColor, false, -1.0f);
-            }
+        DrawDebugSphere(World, Location, 15.0f, 6, Color, false, -1.0f);
+
+        // Draw occlusion line
+        if (Settings->bDrawOcclusionRays && ListenerDataArray.Num() > 0)
+        {
+            FColor OcclusionColor = FColor::MakeRedToGreenColorFromScalar(1.0f - Sources.ColdData[i].CurrentParams.Occlusion);
+            DrawDebugLine(World, ListenerDataArray[0].Location, Location, OcclusionColor, false, -1.0f);
         }
     }
 
@@ -0,0 +1,500 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticGeometryScene.h"
+#include "AcousticEngineModule.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "StaticMeshResources.h"
+#include "UObject/UObjectIterator.h"
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+void FAcousticGeometryScene::Reset()
+{
+    Meshes.Empty();
+    MeshLookup.Empty();
+    Instances.Empty();
+    MovableInstances.Empty();
+    TopLevel.Reset();
+    InstanceBounds.Empty();
+    TopLevelBuildCost = 0.0f;
+    bTopLevelDirty = false;
+    SectionMaterials.Empty();
+    ProxyMaterials.Empty();
+    ProxyMaterialIndices.Empty();
+    NumSkippedMeshes = 0;
+}
+
+void FAcousticGeometryScene::Build(UWorld* World, ECollisionChannel Channel, int32 ProxyLOD)
+{
+    Reset();
+
+    if (!World)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (TObjectIterator<UStaticMeshComponent> It; It; ++It)
+    {
+        const UStaticMeshComponent* Component = *It;
+        if (Component->GetWorld() == World && ShouldIncludeComponent(Component, Channel))
+        {
+            AddComponent(Component, ProxyLOD);
+        }
+    }
+
+    RebuildTopLevel();
+
+    UE_LOG(LogAcousticEngine, Log, TEXT("Acoustic geometry scene: %d instances (%d movable) of %d meshes, %d triangles (%d meshes skipped without CPU access), %.1f ms"),
+        Instances.Num(), MovableInstances.Num(), Meshes.Num(), GetNumTriangles(), NumSkippedMeshes,
+        (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FAcousticGeometryScene::AddActor(const AActor* Actor, ECollisionChannel Channel, int32 ProxyLOD)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    Actor->ForEachComponent<UStaticMeshComponent>(false, [this, Channel, ProxyLOD](const UStaticMeshComponent* Component)
+    {
+        if (ShouldIncludeComponent(Component, Channel))
+        {
+            AddComponent(Component, ProxyLOD);
+        }
+    });
+}
+
+bool FAcousticGeometryScene::ShouldIncludeComponent(const UStaticMeshComponent* Component, ECollisionChannel Channel)
+{
+    return Component->IsRegistered() &&
+        Component->IsQueryCollisionEnabled() &&
+        Component->GetCollisionResponseToChannel(Channel) == ECR_Block;
+}
+
+void FAcousticGeometryScene::AddComponent(const UStaticMeshComponent* Component, int32 ProxyLOD)
+{
+    const int32 MeshIndex = FindOrAddMesh(Component->GetStaticMesh(), ProxyLOD);
+    if (MeshIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Components may override the mesh's materials, so sections resolve per component
+    const int32 FirstSectionMaterial = SectionMaterials.Num();
+    for (const int32 MaterialSlot : Meshes[MeshIndex].SectionMaterialSlots)
+    {
+        const UMaterialInterface* Material = Component->GetMaterial(MaterialSlot);
+        SectionMaterials.Add(FindOrAddProxyMaterial(Material ? Material->GetPhysicalMaterial() : nullptr));
+    }
+
+    auto AddInstance = [&](int32 InstanceIndex)
+    {
+        FInstance Instance;
+        Instance.Component = Component;
+        Instance.InstanceIndex = InstanceIndex;
+        Instance.Mesh = MeshIndex;
+        Instance.FirstSectionMaterial = FirstSectionMaterial;
+        Instance.bMovable = Component->Mobility == EComponentMobility::Movable;
+
+        FTransform Transform;
+        if (GetInstanceTransform(Instance, Transform))
+        {
+            SetInstanceTransform(Instance, Transform);
+            Instances.Add(Instance);
+        }
+    };
+
+    if (const UInstancedStaticMeshComponent* Instanced = Cast<UInstancedStaticMeshComponent>(Component))
+    {
+        for (int32 InstanceIndex = 0; InstanceIndex < Instanced->GetInstanceCount(); ++InstanceIndex)
+        {
+            AddInstance(InstanceIndex);
+        }
+    }
+    else
+    {
+        AddInstance(INDEX_NONE);
+    }
+
+    bTopLevelDirty = true;
+}
+
+int32 FAcousticGeometryScene::FindOrAddMesh(const UStaticMesh* Mesh, int32 ProxyLOD)
+{
+    if (!Mesh)
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Existing = MeshLookup.Find(Mesh))
+    {
+        return *Existing;
+    }
+
+    const FStaticMeshRenderData* RenderData = Mesh->GetRenderData();
+    if (!RenderData || RenderData->LODResources.Num() == 0)
+    {
+        MeshLookup.Add(Mesh, INDEX_NONE);
+        return INDEX_NONE;
+    }
+
+    const FStaticMeshLODResources& LODResources = RenderData->LODResources[FMath::Clamp(ProxyLOD, 0, RenderData->LODResources.Num() - 1)];
+    const FPositionVertexBuffer& Positions = LODResources.VertexBuffers.PositionVertexBuffer;
+    const FIndexArrayView Indices = LODResources.IndexBuffer.GetArrayView();
+
+    // Cooked meshes drop their CPU copy unless Allow CPU Access is set
+    if (Positions.GetVertexData() == nullptr || Indices.Num() == 0)
+    {
+        NumSkippedMeshes++;
+        MeshLookup.Add(Mesh, INDEX_NONE);
+        return INDEX_NONE;
+    }
+
+    FMeshProxy Proxy;
+    TArray<FVector3f> Vertices;
+
+    for (int32 SectionIndex = 0; SectionIndex < LODResources.Sections.Num(); ++SectionIndex)
+    {
+        const FStaticMeshSection& Section = LODResources.Sections[SectionIndex];
+        Proxy.SectionMaterialSlots.Add(Section.MaterialIndex);
+
+        if (!Section.bEnableCollision)
+        {
+            continue;
+        }
+
+        for (uint32 TriIndex = 0; TriIndex < Section.NumTriangles; ++TriIndex)
+        {
+            const uint32 BaseIndex = Section.FirstIndex + TriIndex * 3;
+            const FVector3f A = Positions.VertexPosition(Indices[BaseIndex + 0]);
+            const FVector3f B = Positions.VertexPosition(Indices[BaseIndex + 1]);
+            const FVector3f C = Positions.VertexPosition(Indices[BaseIndex + 2]);
+
+            // Degenerate triangles can never be hit
+            const FVector3f Normal = FVector3f::CrossProduct(B - A, C - A);
+            if (Normal.SizeSquared() < UE_KINDA_SMALL_NUMBER)
+            {
+                continue;
+            }
+
+            Vertices.Add(A);
+            Vertices.Add(B);
+            Vertices.Add(C);
+            Proxy.TriangleNormals.Add(Normal.GetUnsafeNormal());
+            Proxy.TriangleSections.Add(static_cast<uint16>(SectionIndex));
+        }
+    }
+
+    Proxy.BVH.Build(Vertices);
+    if (Proxy.BVH.IsEmpty())
+    {
+        MeshLookup.Add(Mesh, INDEX_NONE);
+        return INDEX_NONE;
+    }
+
+    const int32 MeshIndex = Meshes.Add(MoveTemp(Proxy));
+    MeshLookup.Add(Mesh, MeshIndex);
+    return MeshIndex;
+}
+
+uint16 FAcousticGeometryScene::FindOrAddProxyMaterial(const UPhysicalMaterial* PhysMat)
+{
+    const int32 Existing = ProxyMaterials.IndexOfByKey(PhysMat);
+    if (Existing != INDEX_NONE)
+    {
+        return static_cast<uint16>(Existing);
+    }
+
+    // Physical materials in a level number in the tens; past the id range everything shares the last one
+    if (ProxyMaterials.Num() > MAX_uint16)
+    {
+        return MAX_uint16;
+    }
+
+    // Resolved on the next ResolveMaterials, default until then
+    ProxyMaterialIndices.Add(SurfaceType_Default);
+    return static_cast<uint16>(ProxyMaterials.Add(PhysMat));
+}
+
+void FAcousticGeometryScene::ResolveMaterials(TFunctionRef<uint8(const UPhysicalMaterial*)> ResolveMaterialIndex)
+{
+    ProxyMaterialIndices.SetNumUninitialized(ProxyMaterials.Num());
+    for (int32 Index = 0; Index < ProxyMaterials.Num(); ++Index)
+    {
+        ProxyMaterialIndices[Index] = ResolveMaterialIndex(ProxyMaterials[Index].Get());
+    }
+}
+
+int32 FAcousticGeometryScene::GetNumTriangles() const
+{
+    int32 NumTriangles = 0;
+    for (const FMeshProxy& Mesh : Meshes)
+    {
+        NumTriangles += Mesh.BVH.GetNumTriangles();
+    }
+    return NumTriangles;
+}
+
+// ============================================================================
+// INSTANCES
+// ============================================================================
+
+bool FAcousticGeometryScene::GetInstanceTransform(const FInstance& Instance, FTransform& OutTransform)
+{
+    const UStaticMeshComponent* Component = Instance.Component.Get();
+    if (!Component || !Component->IsRegistered())
+    {
+        return false;
+    }
+
+    if (Instance.InstanceIndex == INDEX_NONE)
+    {
+        OutTransform = Component->GetComponentTransform();
+        return true;
+    }
+
+    const UInstancedStaticMeshComponent* Instanced = Cast<UInstancedStaticMeshComponent>(Component);
+    return Instanced && Instanced->GetInstanceTransform(Instance.InstanceIndex, OutTransform, true);
+}
+
+void FAcousticGeometryScene::SetInstanceTransform(FInstance& Instance, const FTransform& Transform) const
+{
+    Instance.Transform = Transform;
+    Instance.LocalToWorld = FMatrix44f(Transform.ToMatrixWithScale());
+    Instance.WorldToLocal = Instance.LocalToWorld.Inverse();
+    Instance.WorldBounds = Meshes[Instance.Mesh].BVH.GetBounds().TransformBy(Instance.LocalToWorld);
+}
+
+void FAcousticGeometryScene::RebuildTopLevel()
+{
+    MovableInstances.Reset();
+    InstanceBounds.SetNumUninitialized(Instances.Num());
+
+    for (int32 InstanceIndex = 0; InstanceIndex < Instances.Num(); ++InstanceIndex)
+    {
+        InstanceBounds[InstanceIndex] = Instances[InstanceIndex].WorldBounds;
+        if (Instances[InstanceIndex].bMovable)
+        {
+            MovableInstances.Add(InstanceIndex);
+        }
+    }
+
+    TopLevel.BuildFromBounds(InstanceBounds);
+    TopLevelBuildCost = TopLevel.GetTreeCost();
+    bTopLevelDirty = false;
+}
+
+int32 FAcousticGeometryScene::UpdateInstances(TArray<FBox>& OutChangedBounds)
+{
+    int32 NumMoved = 0;
+    bool bAnyRemoved = false;
+
+    for (const int32 InstanceIndex : MovableInstances)
+    {
+        FInstance& Instance = Instances[InstanceIndex];
+
+        // Destroyed - whatever it occluded is audible now
+        FTransform Transform;
+        if (!GetInstanceTransform(Instance, Transform))
+        {
+            OutChangedBounds.Add(FBox(FVector(Instance.WorldBounds.Min), FVector(Instance.WorldBounds.Max)));
+            Instance.Mesh = INDEX_NONE;
+            bAnyRemoved = true;
+            continue;
+        }
+
+        if (Transform.Equals(Instance.Transform, UE_KINDA_SMALL_NUMBER))
+        {
+            continue;
+        }
+
+        OutChangedBounds.Add(FBox(FVector(Instance.WorldBounds.Min), FVector(Instance.WorldBounds.Max)));
+        SetInstanceTransform(Instance, Transform);
+        OutChangedBounds.Add(FBox(FVector(Instance.WorldBounds.Min), FVector(Instance.WorldBounds.Max)));
+        InstanceBounds[InstanceIndex] = Instance.WorldBounds;
+        NumMoved++;
+    }
+
+    if (bAnyRemoved)
+    {
+        Instances.RemoveAll([](const FInstance& Instance) { return Instance.Mesh == INDEX_NONE; });
+        bTopLevelDirty = true;
+    }
+
+    // Instances added or removed need a new tree; moves only need the boxes refit
+    if (bTopLevelDirty)
+    {
+        RebuildTopLevel();
+    }
+    else if (NumMoved > 0)
+    {
+        TopLevel.Refit(InstanceBounds);
+        if (TopLevel.GetTreeCost() > TopLevelBuildCost * RefitRebuildRatio)
+        {
+            RebuildTopLevel();
+        }
+    }
+
+    return NumMoved;
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+bool FAcousticGeometryScene::IntersectInstance(int32 InstanceIndex, const FVector3f& Origin, const FVector3f& Direction, float& MaxDistance, int32& OutTriangle) const
+{
+    // Unnormalized local direction keeps distances in world units
+    const FInstance& Instance = Instances[InstanceIndex];
+    const FAcousticBVHHit Hit = Meshes[Instance.Mesh].BVH.Intersect(
+        FVector3f(Instance.WorldToLocal.TransformPosition(Origin)),
+        FVector3f(Instance.WorldToLocal.TransformVector(Direction)),
+        MaxDistance);
+
+    if (!Hit.IsValid())
+    {
+        return false;
+    }
+
+    MaxDistance = Hit.Distance;
+    OutTriangle = Hit.Triangle;
+    return true;
+}
+
+void FAcousticGeometryScene::FillHit(int32 InstanceIndex, int32 Triangle, float Distance, const FVector3f& Origin, const FVector3f& Direction, FAcousticRayHit& OutHit) const
+{
+    if (InstanceIndex == INDEX_NONE)
+    {
+        OutHit = FAcousticRayHit();
+        return;
+    }
+
+    const FInstance& Instance = Instances[InstanceIndex];
+    const FMeshProxy& Mesh = Meshes[Instance.Mesh];
+
+    // Normals go through the inverse transpose; proxies are two-sided, so face it back toward the ray
+    FVector3f Normal = FVector3f(Instance.WorldToLocal.GetTransposed().TransformVector(Mesh.TriangleNormals[Triangle])).GetSafeNormal();
+    if (FVector3f::DotProduct(Normal, Direction) > 0.0f)
+    {
+        Normal = -Normal;
+    }
+
+    const uint16 ProxyMaterial = SectionMaterials[Instance.FirstSectionMaterial + Mesh.TriangleSections[Triangle]];
+
+    OutHit.bIsValidHit = true;
+    OutHit.HitLocation = FVector(Origin + Direction * Distance);
+    OutHit.HitNormal = FVector(Normal);
+    OutHit.Distance = Distance;
+    OutHit.MaterialIndex = ProxyMaterialIndices.IsValidIndex(ProxyMaterial) ? ProxyMaterialIndices[ProxyMaterial] : static_cast<uint8>(SurfaceType_Default);
+    OutHit.bIsDynamicHit = Instance.bMovable;
+}
+
+bool FAcousticGeometryScene::TraceSingle(const FVector& Start, const FVector& End, FAcousticRayHit& OutHit, bool bMovableOnly) const
+{
+    const FVector3f Origin(Start);
+    const FVector3f Delta(End - Start);
+    const float Length = Delta.Size();
+    if (Length < UE_KINDA_SMALL_NUMBER || TopLevel.IsEmpty())
+    {
+        OutHit = FAcousticRayHit();
+        return false;
+    }
+
+    const FVector3f Direction = Delta / Length;
+    float BestDistance = Length;
+    int32 BestInstance = INDEX_NONE;
+    int32 BestTriangle = INDEX_NONE;
+
+    TopLevel.Traverse(Origin, Direction, Length, [&](int32 InstanceIndex, float MaxDistance)
+    {
+        if (!bMovableOnly || Instances[InstanceIndex].bMovable)
+        {
+            if (IntersectInstance(InstanceIndex, Origin, Direction, BestDistance, BestTriangle))
+            {
+                BestInstance = InstanceIndex;
+            }
+        }
+        return BestDistance;
+    });
+
+    FillHit(BestInstance, BestTriangle, BestDistance, Origin, Direction, OutHit);
+    return OutHit.bIsValidHit;
+}
+
+void FAcousticGeometryScene::TracePacket(const FAcousticRayPacket& Packet, FAcousticRayHit OutHits[FAcousticRayPacket::Width]) const
+{
+    int32 HitInstances[FAcousticRayPacket::Width] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+    int32 HitTriangles[FAcousticRayPacket::Width] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+    float HitDistances[FAcousticRayPacket::Width] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    TopLevel.TraversePacket(Packet, [&](int32 InstanceIndex, int32 LaneMask, float MaxDistances[FAcousticRayPacket::Width])
+    {
+        const FInstance& Instance = Instances[InstanceIndex];
+
+        // The packet in the instance's space; lanes that missed its leaf are disabled
+        FAcousticRayPacket LocalPacket;
+        LocalPacket.NumRays = Packet.NumRays;
+        for (int32 Lane = 0; Lane < Packet.NumRays; ++Lane)
+        {
+            LocalPacket.Origins[Lane] = FVector3f(Instance.WorldToLocal.TransformPosition(Packet.Origins[Lane]));
+            LocalPacket.Directions[Lane] = FVector3f(Instance.WorldToLocal.TransformVector(Packet.Directions[Lane]));
+            LocalPacket.MaxDistances[Lane] = (LaneMask & (1 << Lane)) ? MaxDistances[Lane] : -1.0f;
+        }
+
+        FAcousticBVHHit Hits[FAcousticRayPacket::Width];
+        Meshes[Instance.Mesh].BVH.IntersectPacket(LocalPacket, Hits);
+
+        for (int32 Lane = 0; Lane < Packet.NumRays; ++Lane)
+        {
+            if (Hits[Lane].IsValid())
+            {
+                MaxDistances[Lane] = Hits[Lane].Distance;
+                HitDistances[Lane] = Hits[Lane].Distance;
+                HitInstances[Lane] = InstanceIndex;
+                HitTriangles[Lane] = Hits[Lane].Triangle;
+            }
+        }
+    });
+
+    for (int32 Lane = 0; Lane < Packet.NumRays; ++Lane)
+    {
+        FillHit(HitInstances[Lane], HitTriangles[Lane], HitDistances[Lane], Packet.Origins[Lane], Packet.Directions[Lane], OutHits[Lane]);
+    }
+}
+
+void FAcousticGeometryScene::TraceRays(const FVector& Origin, TConstArrayView<FVector> Directions, float MaxDistance, TArrayView<FAcousticRayHit> OutHits) const
+{
+    check(OutHits.Num() == Directions.Num());
+
+    FAcousticRayPacket Packet;
+    FAcousticRayHit PacketHits[FAcousticRayPacket::Width];
+
+    for (int32 First = 0; First < Directions.Num(); First += FAcousticRayPacket::Width)
+    {
+        Packet.NumRays = FMath::Min(FAcousticRayPacket::Width, Directions.Num() - First);
+        for (int32 Lane = 0; Lane < Packet.NumRays; ++Lane)
+        {
+            Packet.Origins[Lane] = FVector3f(Origin);
+            Packet.Directions[Lane] = FVector3f(Directions[First + Lane]);
+            Packet.MaxDistances[Lane] = MaxDistance;
+        }
+
+        TracePacket(Packet, PacketHits);
+
+        for (int32 Lane = 0; Lane < Packet.NumRays; ++Lane)
+        {
+            OutHits[First + Lane] = PacketHits[Lane];
+        }
+    }
+}
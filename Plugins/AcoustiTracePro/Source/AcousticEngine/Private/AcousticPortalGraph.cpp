@@ -0,0 +1,302 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticPortalGraph.h"
+#include "AcousticZoneVolume.h"
+#include "Algo/Reverse.h"
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+void FAcousticPortalGraph::Build(const TArray<TWeakObjectPtr<AAcousticZoneVolume>>& Zones,
+    const TArray<TWeakObjectPtr<AAcousticPortalVolume>>& InPortals, float MinOpenness)
+{
+    Reset();
+    TopologyGeneration++;
+
+    // Node 0 is everything outside a zone
+    NodeCenters.AddDefaulted();
+    NodePortals.AddDefaulted();
+
+    for (const TWeakObjectPtr<AAcousticZoneVolume>& ZonePtr : Zones)
+    {
+        const AAcousticZoneVolume* Zone = ZonePtr.Get();
+        if (!Zone || ZoneNodes.Contains(Zone))
+        {
+            continue;
+        }
+
+        FVector Origin, Extent;
+        Zone->GetActorBounds(false, Origin, Extent);
+
+        ZoneNodes.Add(Zone, NodeCenters.Num());
+        NodeCenters.Emplace(Origin);
+        NodePortals.AddDefaulted();
+    }
+
+    for (const TWeakObjectPtr<AAcousticPortalVolume>& PortalPtr : InPortals)
+    {
+        const AAcousticPortalVolume* Actor = PortalPtr.Get();
+        if (!Actor || PortalLookup.Contains(Actor))
+        {
+            continue;
+        }
+
+        FPortal Portal;
+        Portal.Actor = Actor;
+        Portal.Center = Actor->GetPortalCenter();
+        Portal.NodeA = FindZoneNode(Actor->ZoneA);
+        Portal.NodeB = FindZoneNode(Actor->ZoneB);
+        RefreshPortal(Portal, *Actor, MinOpenness);
+
+        // A portal with the same zone on both sides connects nothing
+        if (Portal.NodeA == Portal.NodeB)
+        {
+            continue;
+        }
+
+        const int32 PortalIndex = Portals.Add(Portal);
+        PortalLookup.Add(Actor, PortalIndex);
+        NodePortals[Portal.NodeA].Add(PortalIndex);
+        NodePortals[Portal.NodeB].Add(PortalIndex);
+    }
+}
+
+bool FAcousticPortalGraph::UpdatePortal(const AAcousticPortalVolume* Portal, float MinOpenness)
+{
+    const int32* PortalIndex = Portal ? PortalLookup.Find(Portal) : nullptr;
+    if (!PortalIndex)
+    {
+        return false;
+    }
+
+    // Transmission and LPF are read live by FindPath, so a swinging portal keeps the cache
+    FPortal& Snapshot = Portals[*PortalIndex];
+    const bool bWasOpen = Snapshot.bOpen;
+    const bool bChanged = RefreshPortal(Snapshot, *Portal, MinOpenness);
+
+    // Routes and audible sets only depend on open or closed
+    if (Snapshot.bOpen != bWasOpen)
+    {
+        RouteCache.Reset();
+        TopologyGeneration++;
+    }
+    return bChanged;
+}
+
+void FAcousticPortalGraph::Reset()
+{
+    Portals.Reset();
+    PortalLookup.Reset();
+    ZoneNodes.Reset();
+    NodeCenters.Reset();
+    NodePortals.Reset();
+    RouteCache.Reset();
+}
+
+bool FAcousticPortalGraph::RefreshPortal(FPortal& Portal, const AAcousticPortalVolume& Actor, float MinOpenness)
+{
+    const bool bOpen = Actor.Openness >= MinOpenness;
+    const float Transmission = Actor.GetCurrentTransmission();
+    const float LPFCutoff = Actor.GetCurrentLPFCutoff();
+
+    const bool bChanged = bOpen != Portal.bOpen ||
+        !FMath::IsNearlyEqual(Transmission, Portal.Transmission) ||
+        !FMath::IsNearlyEqual(LPFCutoff, Portal.LPFCutoff);
+
+    Portal.bOpen = bOpen;
+    Portal.Transmission = Transmission;
+    Portal.LPFCutoff = LPFCutoff;
+    return bChanged;
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+int32 FAcousticPortalGraph::FindZoneNode(const AAcousticZoneVolume* Zone) const
+{
+    const int32* Node = Zone ? ZoneNodes.Find(Zone) : nullptr;
+    return Node ? *Node : OutsideNode;
+}
+
+bool FAcousticPortalGraph::FindPath(int32 SourceNode, const FVector& SourceLocation, int32 ListenerNode,
+    const FVector& ListenerLocation, FAcousticPortalPath& OutPath)
+{
+    if (SourceNode == ListenerNode || !NodePortals.IsValidIndex(SourceNode) || !NodePortals.IsValidIndex(ListenerNode))
+    {
+        return false;
+    }
+
+    const uint64 RouteKey = (static_cast<uint64>(SourceNode) << 32) | static_cast<uint32>(ListenerNode);
+    FRoute* Route = RouteCache.Find(RouteKey);
+    if (!Route)
+    {
+        Route = &RouteCache.Add(RouteKey);
+        SearchRoute(SourceNode, ListenerNode, *Route);
+    }
+
+    if (!Route->bReachable)
+    {
+        return false;
+    }
+
+    // The route is shared by the zone pair; the end legs belong to this source and listener
+    OutPath = FAcousticPortalPath();
+    FVector Previous = SourceLocation;
+    for (const int32 PortalIndex : Route->Portals)
+    {
+        const FPortal& Portal = Portals[PortalIndex];
+        OutPath.PathLength += FVector::Dist(Previous, Portal.Center);
+        OutPath.Transmission *= Portal.Transmission;
+        OutPath.LPFCutoff = FMath::Min(OutPath.LPFCutoff, Portal.LPFCutoff);
+        Previous = Portal.Center;
+    }
+
+    OutPath.PathLength += FVector::Dist(Previous, ListenerLocation);
+    OutPath.ArrivalLocation = Previous;
+    OutPath.NumPortals = Route->Portals.Num();
+    return true;
+}
+
+void FAcousticPortalGraph::ComputeAudibleSet(int32 ListenerNode, FAcousticAudibleZoneSet& OutSet) const
+{
+    OutSet.ListenerNode = ListenerNode;
+    OutSet.TopologyGeneration = TopologyGeneration;
+
+    // A listener in a zone without portals can't be reasoned about - everything stays audible
+    const int32 NumNodes = NodePortals.Num();
+    if (!NodePortals.IsValidIndex(ListenerNode) || NodePortals[ListenerNode].Num() == 0)
+    {
+        OutSet.Nodes.Init(true, NumNodes);
+        return;
+    }
+
+    // Zones without portals were never sealed off by the level - keep them audible too
+    OutSet.Nodes.Init(false, NumNodes);
+    for (int32 Node = 0; Node < NumNodes; Node++)
+    {
+        if (NodePortals[Node].Num() == 0)
+        {
+            OutSet.Nodes[Node] = true;
+        }
+    }
+
+    TArray<int32, TInlineAllocator<32>> Stack;
+    Stack.Add(ListenerNode);
+    OutSet.Nodes[ListenerNode] = true;
+
+    while (Stack.Num() > 0)
+    {
+        const int32 Node = Stack.Pop(EAllowShrinking::No);
+        for (const int32 PortalIndex : NodePortals[Node])
+        {
+            const FPortal& Portal = Portals[PortalIndex];
+            const int32 Other = Portal.NodeA == Node ? Portal.NodeB : Portal.NodeA;
+            if (Portal.bOpen && !OutSet.Nodes[Other])
+            {
+                OutSet.Nodes[Other] = true;
+                Stack.Add(Other);
+            }
+        }
+    }
+}
+
+void FAcousticPortalGraph::SearchRoute(int32 FromNode, int32 ToNode, FRoute& OutRoute) const
+{
+    OutRoute.Portals.Reset();
+    OutRoute.bReachable = false;
+
+    // One state per portal and crossing direction: 2p crosses A -> B, 2p + 1 crosses B -> A
+    const int32 NumStates = Portals.Num() * 2;
+    TArray<float, TInlineAllocator<64>> Costs;
+    TArray<int32, TInlineAllocator<64>> Previous;
+    TBitArray<TInlineAllocator<2>> Settled(false, NumStates);
+    Costs.Init(TNumericLimits<float>::Max(), NumStates);
+    Previous.Init(INDEX_NONE, NumStates);
+
+    auto EnteredNode = [this](int32 State) {
+        const FPortal& Portal = Portals[State / 2];
+        return (State & 1) ? Portal.NodeA : Portal.NodeB;
+    };
+
+    // Zone centers stand in for the end points; the outside has no center and costs nothing
+    auto EndCost = [this](int32 Node, const FVector& PortalCenter) {
+        return NodeCenters[Node].IsSet() ? FVector::Dist(NodeCenters[Node].GetValue(), PortalCenter) : 0.0f;
+    };
+
+    for (const int32 PortalIndex : NodePortals[FromNode])
+    {
+        const FPortal& Portal = Portals[PortalIndex];
+        if (Portal.bOpen)
+        {
+            const int32 State = PortalIndex * 2 + (Portal.NodeA == FromNode ? 0 : 1);
+            Costs[State] = EndCost(FromNode, Portal.Center);
+        }
+    }
+
+    // Graphs are a handful of portals - a linear scan beats a heap
+    float BestCost = TNumericLimits<float>::Max();
+    int32 BestState = INDEX_NONE;
+
+    for (;;)
+    {
+        int32 State = INDEX_NONE;
+        for (int32 s = 0; s < NumStates; s++)
+        {
+            if (!Settled[s] && Costs[s] < TNumericLimits<float>::Max() && (State == INDEX_NONE || Costs[s] < Costs[State]))
+            {
+                State = s;
+            }
+        }
+
+        if (State == INDEX_NONE || Costs[State] >= BestCost)
+        {
+            break;
+        }
+        Settled[State] = true;
+
+        const FPortal& Portal = Portals[State / 2];
+        const int32 Node = EnteredNode(State);
+
+        if (Node == ToNode)
+        {
+            const float Total = Costs[State] + EndCost(ToNode, Portal.Center);
+            if (Total < BestCost)
+            {
+                BestCost = Total;
+                BestState = State;
+            }
+            continue;
+        }
+
+        for (const int32 NextIndex : NodePortals[Node])
+        {
+            const FPortal& Next = Portals[NextIndex];
+            if (NextIndex == State / 2 || !Next.bOpen)
+            {
+                continue;
+            }
+
+            const int32 NextState = NextIndex * 2 + (Next.NodeA == Node ? 0 : 1);
+            const float Cost = Costs[State] + FVector::Dist(Portal.Center, Next.Center);
+            if (!Settled[NextState] && Cost < Costs[NextState])
+            {
+                Costs[NextState] = Cost;
+                Previous[NextState] = State;
+            }
+        }
+    }
+
+    if (BestState == INDEX_NONE)
+    {
+        return;
+    }
+
+    for (int32 State = BestState; State != INDEX_NONE; State = Previous[State])
+    {
+        OutRoute.Portals.Add(State / 2);
+    }
+    Algo::Reverse(OutRoute.Portals);
+    OutRoute.bReachable = true;
+}
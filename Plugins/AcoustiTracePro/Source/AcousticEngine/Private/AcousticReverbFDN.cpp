@@ -0,0 +1,147 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticReverbFDN.h"
+
+namespace
+{
+    /** Unnormalized 4-point Hadamard transform within one register */
+    FORCEINLINE VectorRegister4Float Hadamard4(VectorRegister4Float X, const VectorRegister4Float& SignsA, const VectorRegister4Float& SignsB)
+    {
+        X = VectorMultiplyAdd(X, SignsA, VectorSwizzle(X, 1, 0, 3, 2));
+        return VectorMultiplyAdd(X, SignsB, VectorSwizzle(X, 2, 3, 0, 1));
+    }
+}
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+void FAcousticReverbFDN::Init(float InSampleRate)
+{
+    SampleRate = FMath::Max(InSampleRate, 8000.0f);
+
+    int32 MaxDelay = 0;
+    for (int32 Line = 0; Line < NumLines; Line++)
+    {
+        Delays[Line] = FMath::Max(FMath::RoundToInt(BaseDelays[Line] * (SampleRate / 44100.0f)), 1);
+        MaxDelay = FMath::Max(MaxDelay, Delays[Line]);
+    }
+
+    const uint32 NumPositions = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(MaxDelay) + 1);
+    Mask = NumPositions - 1;
+    Buffer.SetNumUninitialized(NumPositions * NumLines);
+
+    // Force the next SetDecay to compute coefficients
+    LastRT60 = -1.0f;
+    Reset();
+}
+
+void FAcousticReverbFDN::Reset()
+{
+    FMemory::Memzero(Buffer.GetData(), Buffer.Num() * sizeof(float));
+    FMemory::Memzero(LPFStates, sizeof(LPFStates));
+    FMemory::Memzero(HPFStates, sizeof(HPFStates));
+    WritePos = 0;
+}
+
+void FAcousticReverbFDN::SetDecay(float RT60, float HFDecay, float LFDecay)
+{
+    if (RT60 == LastRT60 && HFDecay == LastHFDecay && LFDecay == LastLFDecay)
+    {
+        return;
+    }
+
+    LastRT60 = RT60;
+    LastHFDecay = HFDecay;
+    LastLFDecay = LFDecay;
+
+    // Each line loses 60 dB over RT60 regardless of its length: g = 10^(-3 * d / (fs * RT60))
+    const float DecaySamples = SampleRate * FMath::Max(RT60, 0.1f);
+    for (int32 Line = 0; Line < NumLines; Line++)
+    {
+        DecayGains[Line] = FMath::Min(FMath::Pow(10.0f, -3.0f * Delays[Line] / DecaySamples), 0.99f);
+    }
+
+    HFCoeff = 1.0f - HFDecay * 0.5f;
+    LFCoeff = 1.0f - LFDecay * 0.5f;
+}
+
+// ============================================================================
+// PROCESSING
+// ============================================================================
+
+void FAcousticReverbFDN::ProcessBlock(const float* Input, float* OutLeft, float* OutRight, int32 NumFrames)
+{
+    if (Buffer.Num() == 0)
+    {
+        FMemory::Memzero(OutLeft, NumFrames * sizeof(float));
+        FMemory::Memzero(OutRight, NumFrames * sizeof(float));
+        return;
+    }
+
+    float* RESTRICT Lines = Buffer.GetData();
+
+    // Block constants
+    const VectorRegister4Float SignsA = MakeVectorRegisterFloat(1.0f, -1.0f, 1.0f, -1.0f);
+    const VectorRegister4Float SignsB = MakeVectorRegisterFloat(1.0f, 1.0f, -1.0f, -1.0f);
+    const VectorRegister4Float InputSigns = MakeVectorRegisterFloat(1.0f, -1.0f, 1.0f, -1.0f);
+    const VectorRegister4Float MatrixScale = VectorSetFloat1(1.0f / UE_SQRT_2 / 2.0f); // 1 / sqrt(8)
+    const VectorRegister4Float OutputScale = VectorSetFloat1(0.5f);
+    const VectorRegister4Float HF = VectorSetFloat1(HFCoeff);
+    const VectorRegister4Float LF = VectorSetFloat1(LFCoeff);
+    const VectorRegister4Float GainA = VectorLoadAligned(DecayGains);
+    const VectorRegister4Float GainB = VectorLoadAligned(DecayGains + 4);
+
+    // Filter state lives in registers for the whole block
+    VectorRegister4Float LPFA = VectorLoadAligned(LPFStates);
+    VectorRegister4Float LPFB = VectorLoadAligned(LPFStates + 4);
+    VectorRegister4Float HPFA = VectorLoadAligned(HPFStates);
+    VectorRegister4Float HPFB = VectorLoadAligned(HPFStates + 4);
+
+    alignas(16) float Taps[NumLines];
+    alignas(16) float Stereo[4];
+
+    for (int32 Frame = 0; Frame < NumFrames; Frame++)
+    {
+        // One masked read per line
+        for (int32 Line = 0; Line < NumLines; Line++)
+        {
+            Taps[Line] = Lines[((WritePos - Delays[Line]) & Mask) * NumLines + Line];
+        }
+        const VectorRegister4Float TapA = VectorLoadAligned(Taps);
+        const VectorRegister4Float TapB = VectorLoadAligned(Taps + 4);
+
+        // HF damping: y = (1 - a) * x + a * y
+        LPFA = VectorMultiplyAdd(VectorSubtract(LPFA, TapA), HF, TapA);
+        LPFB = VectorMultiplyAdd(VectorSubtract(LPFB, TapB), HF, TapB);
+
+        // LF damping: y = b * (s + x), s = y - x
+        const VectorRegister4Float OutA = VectorMultiply(LF, VectorAdd(HPFA, LPFA));
+        const VectorRegister4Float OutB = VectorMultiply(LF, VectorAdd(HPFB, LPFB));
+        HPFA = VectorSubtract(OutA, LPFA);
+        HPFB = VectorSubtract(OutB, LPFB);
+
+        // Even lines left, odd lines right
+        VectorRegister4Float Sum = VectorAdd(OutA, OutB);
+        Sum = VectorMultiply(VectorAdd(Sum, VectorSwizzle(Sum, 2, 3, 0, 1)), OutputScale);
+        VectorStoreAligned(Sum, Stereo);
+        OutLeft[Frame] = Stereo[0];
+        OutRight[Frame] = Stereo[1];
+
+        // H8 = [H4 H4; H4 -H4], normalized so the matrix is lossless and decay is set by the gains alone
+        const VectorRegister4Float HA = Hadamard4(VectorMultiply(OutA, GainA), SignsA, SignsB);
+        const VectorRegister4Float HB = Hadamard4(VectorMultiply(OutB, GainB), SignsA, SignsB);
+        const VectorRegister4Float In = VectorMultiply(VectorSetFloat1(Input[Frame]), InputSigns);
+
+        float* Frame8 = Lines + WritePos * NumLines;
+        VectorStoreAligned(VectorMultiplyAdd(VectorAdd(HA, HB), MatrixScale, In), Frame8);
+        VectorStoreAligned(VectorMultiplyAdd(VectorSubtract(HA, HB), MatrixScale, In), Frame8 + 4);
+
+        WritePos = (WritePos + 1) & Mask;
+    }
+
+    VectorStoreAligned(LPFA, LPFStates);
+    VectorStoreAligned(LPFB, LPFStates + 4);
+    VectorStoreAligned(HPFA, HPFStates);
+    VectorStoreAligned(HPFB, HPFStates + 4);
+}
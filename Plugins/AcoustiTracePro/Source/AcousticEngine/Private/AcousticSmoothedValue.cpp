@@ -0,0 +1,122 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticSmoothedValue.h"
+#include "DSP/FloatArrayMath.h"
+
+namespace
+{
+    /** Exponential ramps snap to the target once this close, relative to its magnitude */
+    constexpr float ExpSettleTolerance = 1.0e-4f;
+}
+
+void FAcousticSmoothedValue::Init(float InSampleRate, float InRampSeconds, EAcousticRampType InType)
+{
+    SampleRate = FMath::Max(InSampleRate, 1.0f);
+    Type = InType;
+    ExpBlockFrames = 0;
+    SetRampTime(InRampSeconds);
+}
+
+void FAcousticSmoothedValue::SetRampTime(float InRampSeconds)
+{
+    RampSeconds = FMath::Max(InRampSeconds, 0.0f);
+    ExpBlockFrames = 0;
+
+    if (LinearFramesLeft > 0)
+    {
+        StartRamp();
+    }
+}
+
+void FAcousticSmoothedValue::SetTarget(float InTarget)
+{
+    // Operators set the target every block - only a new target restarts the ramp
+    if (InTarget == Target)
+    {
+        return;
+    }
+
+    Target = InTarget;
+    StartRamp();
+}
+
+void FAcousticSmoothedValue::StartRamp()
+{
+    const int32 RampFrames = FMath::RoundToInt(RampSeconds * SampleRate);
+    if (RampFrames <= 0)
+    {
+        Value = Target;
+        LinearFramesLeft = 0;
+        return;
+    }
+
+    LinearStep = (Target - Value) / RampFrames;
+    LinearFramesLeft = Value == Target ? 0 : RampFrames;
+}
+
+void FAcousticSmoothedValue::SetValue(float InValue)
+{
+    Value = InValue;
+    Target = InValue;
+    BlockStart = InValue;
+    BlockStep = 0.0f;
+    LinearFramesLeft = 0;
+}
+
+void FAcousticSmoothedValue::Advance(int32 NumFrames)
+{
+    BlockStart = Value;
+    BlockStep = 0.0f;
+
+    if (Value == Target || NumFrames <= 0)
+    {
+        return;
+    }
+
+    if (Type == EAcousticRampType::Linear)
+    {
+        // The last block of a ramp lands exactly on the target
+        if (LinearFramesLeft <= NumFrames)
+        {
+            Value = Target;
+            LinearFramesLeft = 0;
+        }
+        else
+        {
+            Value += LinearStep * NumFrames;
+            LinearFramesLeft -= NumFrames;
+        }
+    }
+    else
+    {
+        // One exp per block size, not per block and never per sample
+        if (ExpBlockFrames != NumFrames)
+        {
+            ExpBlockFrames = NumFrames;
+            ExpBlockCoeff = RampSeconds > 0.0f ? FMath::Exp(-NumFrames / (RampSeconds * SampleRate)) : 0.0f;
+        }
+
+        Value = Target + (Value - Target) * ExpBlockCoeff;
+        if (FMath::Abs(Value - Target) <= ExpSettleTolerance * FMath::Max(FMath::Abs(Target), 1.0e-3f))
+        {
+            Value = Target;
+        }
+    }
+
+    BlockStep = (Value - BlockStart) / NumFrames;
+}
+
+void FAcousticSmoothedValue::ApplyGain(float* Buffer, int32 NumFrames) const
+{
+    TArrayView<float> View(Buffer, NumFrames);
+    if (BlockStart == Value)
+    {
+        if (Value != 1.0f)
+        {
+            Audio::ArrayMultiplyByConstantInPlace(View, Value);
+        }
+        return;
+    }
+
+    Audio::ArrayFade(View, BlockStart, Value);
+}
@@ -16,9 +16,11 @@
 
 UAcousticSourceComponent::UAcousticSourceComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.bStartWithTickEnabled = true;
-    PrimaryComponentTick.TickInterval = 0.0f; // Tick every frame
+    // Params are pushed by the subsystem when they change - no per-frame tick
+    PrimaryComponentTick.bCanEverTick = false;
+
+    // Moves are reported to the engine from OnUpdateTransform, which is only called when asked for
+    bWantsOnUpdateTransform = true;
 
     bAutoActivate = true;
 
@@ -71,14 +73,14 @@ void UAcousticSourceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 }
 
-void UAcousticSourceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UAcousticSourceComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
 
-    // Apply current params to audio if we have valid data
-    if (bIsRegistered && CurrentParams.bIsValid)
+    // The engine only re-reads positions of sources that report a move
+    if (bIsRegistered && CachedSubsystem)
     {
-        ApplyParamsToAudio();
+        CachedSubsystem->NotifySourceMoved(SourceId);
     }
 }
 
@@ -159,6 +161,7 @@ void UAcousticSourceComponent::FindLinkedAudioComponent()
     }
 
     LinkedAudioComponent = nullptr;
+    PushedAudioParams = FPushedAudioParams();
 
     // Try to find an audio component on the same actor
     AActor* Owner = GetOwner();
@@ -226,36 +229,106 @@ void UAcousticSourceComponent::ApplyParamsToAudio()
     // Apply to audio component via instance parameters
     // These names match what MetaSound graphs expect
 
+    // The subsystem already filtered insignificant changes; only re-send values that moved
+
     // Set occlusion
-    LinkedAudioComponent->SetFloatParameter(GetOcclusionParamName(), CurrentParams.Occlusion);
+    if (PushedAudioParams.Occlusion != CurrentParams.Occlusion)
+    {
+        LinkedAudioComponent->SetFloatParameter(GetOcclusionParamName(), CurrentParams.Occlusion);
+        PushedAudioParams.Occlusion = CurrentParams.Occlusion;
+    }
+
+    // Sound routed through an open portal is heard instead when it is louder than what gets through the wall
+    const float PortalGain = CurrentParams.bHasPortalPath ? CurrentParams.PortalGain : 0.0f;
+    const bool bPortalDominant = PortalGain > CurrentParams.TransmissionGain;
+    const float LowPassCutoff = bPortalDominant ?
+        FMath::Max(CurrentParams.LowPassCutoff, CurrentParams.PortalLPFCutoff) : CurrentParams.LowPassCutoff;
+
+    // Set LPF cutoff, mirrored on the audio component's native filter
+    if (PushedAudioParams.LowPassCutoff != LowPassCutoff)
+    {
+        LinkedAudioComponent->SetFloatParameter(GetLPFCutoffParamName(), LowPassCutoff);
+        LinkedAudioComponent->SetLowPassFilterEnabled(true);
+        LinkedAudioComponent->SetLowPassFilterFrequency(LowPassCutoff);
+        PushedAudioParams.LowPassCutoff = LowPassCutoff;
+    }
 
-    // Set LPF cutoff
-    LinkedAudioComponent->SetFloatParameter(GetLPFCutoffParamName(), CurrentParams.LowPassCutoff);
+    // Set portal path gain and delay
+    if (PushedAudioParams.PortalGain != PortalGain)
+    {
+        LinkedAudioComponent->SetFloatParameter(GetPortalGainParamName(), PortalGain);
+        PushedAudioParams.PortalGain = PortalGain;
+    }
+
+    if (PushedAudioParams.PortalDelayMs != CurrentParams.PortalDelayMs)
+    {
+        LinkedAudioComponent->SetFloatParameter(GetPortalDelayParamName(), CurrentParams.PortalDelayMs);
+        PushedAudioParams.PortalDelayMs = CurrentParams.PortalDelayMs;
+    }
 
     // Set reverb send
-    LinkedAudioComponent->SetFloatParameter(GetReverbSendParamName(), EffectiveReverbSend);
+    if (PushedAudioParams.ReverbSend != EffectiveReverbSend)
+    {
+        LinkedAudioComponent->SetFloatParameter(GetReverbSendParamName(), EffectiveReverbSend);
+        PushedAudioParams.ReverbSend = EffectiveReverbSend;
+    }
 
     // Set spatial width
-    LinkedAudioComponent->SetFloatParameter(GetSpatialWidthParamName(),
-        EffectiveSpatialWidth + CurrentParams.SpatialWidth);
+    const float SpatialWidth = EffectiveSpatialWidth + CurrentParams.SpatialWidth;
+    if (PushedAudioParams.SpatialWidth != SpatialWidth)
+    {
+        LinkedAudioComponent->SetFloatParameter(GetSpatialWidthParamName(), SpatialWidth);
+        PushedAudioParams.SpatialWidth = SpatialWidth;
+    }
+
+    // Set early reflection taps; an invalid tap is silenced but keeps its delay, so the node doesn't crossfade to nothing
+    const TArray<FReflectionTap>& Taps = CurrentParams.EarlyReflections.Taps;
+    for (int32 Tap = 0; Tap < FMath::Min(Taps.Num(), FEarlyReflectionParams::MaxTaps); Tap++)
+    {
+        const FReflectionTap& ReflectionTap = Taps[Tap];
+        const float TapGain = ReflectionTap.bIsValid ? ReflectionTap.Gain : 0.0f;
+
+        if (PushedAudioParams.TapGain[Tap] != TapGain)
+        {
+            LinkedAudioComponent->SetFloatParameter(GetReflectionTapGainParamName(Tap), TapGain);
+            PushedAudioParams.TapGain[Tap] = TapGain;
+        }
+
+        if (!ReflectionTap.bIsValid)
+        {
+            continue;
+        }
+
+        if (PushedAudioParams.TapDelayMs[Tap] != ReflectionTap.DelayMs)
+        {
+            LinkedAudioComponent->SetFloatParameter(GetReflectionTapDelayParamName(Tap), ReflectionTap.DelayMs);
+            PushedAudioParams.TapDelayMs[Tap] = ReflectionTap.DelayMs;
+        }
+
+        if (PushedAudioParams.TapLPFCutoff[Tap] != ReflectionTap.LPFCutoff)
+        {
+            LinkedAudioComponent->SetFloatParameter(GetReflectionTapLPFParamName(Tap), ReflectionTap.LPFCutoff);
+            PushedAudioParams.TapLPFCutoff[Tap] = ReflectionTap.LPFCutoff;
+        }
+    }
 
     // Apply volume based on occlusion (direct attenuation)
     if (!HasFlag(EAcousticSourceFlags::NeverOcclude))
     {
-        float VolumeMultiplier = CurrentParams.TransmissionGain;
+        float VolumeMultiplier = FMath::Max(CurrentParams.TransmissionGain, PortalGain);
         if (const UAcousticSettings* Settings = UAcousticSettings::Get())
         {
             // Apply minimum audibility
             float MinGain = FMath::Pow(10.0f, Settings->MinimumAudibilityDb / 20.0f);
             VolumeMultiplier = FMath::Max(VolumeMultiplier, MinGain);
         }
-        LinkedAudioComponent->SetVolumeMultiplier(VolumeMultiplier);
-    }
 
-    // Apply LPF to the audio component's native filter if available
-    // Note: This depends on the audio component's implementation
-    LinkedAudioComponent->SetLowPassFilterEnabled(true);
-    LinkedAudioComponent->SetLowPassFilterFrequency(CurrentParams.LowPassCutoff);
+        if (PushedAudioParams.VolumeMultiplier != VolumeMultiplier)
+        {
+            LinkedAudioComponent->SetVolumeMultiplier(VolumeMultiplier);
+            PushedAudioParams.VolumeMultiplier = VolumeMultiplier;
+        }
+    }
 }
 
 // ============================================================================
@@ -291,12 +364,47 @@ void UAcousticSourceComponent::SetFlag(EAcousticSourceFlags Flag, bool bEnabled)
 
 void UAcousticSourceComponent::ForceUpdate()
 {
+    // Re-send everything on the next push
+    PushedAudioParams = FPushedAudioParams();
+
     if (bIsRegistered && CachedSubsystem)
     {
         CachedSubsystem->ForceSourceUpdate(SourceId);
     }
 }
 
+namespace
+{
+    /** Acoustic_Tap0_<Suffix> .. Acoustic_Tap7_<Suffix>, built once */
+    TArray<FName> MakeReflectionTapParamNames(const TCHAR* Suffix)
+    {
+        TArray<FName> Names;
+        for (int32 Tap = 0; Tap < FEarlyReflectionParams::MaxTaps; Tap++)
+        {
+            Names.Add(FName(*FString::Printf(TEXT("Acoustic_Tap%d_%s"), Tap, Suffix)));
+        }
+        return Names;
+    }
+}
+
+FName UAcousticSourceComponent::GetReflectionTapDelayParamName(int32 TapIndex)
+{
+    static const TArray<FName> Names = MakeReflectionTapParamNames(TEXT("DelayMs"));
+    return Names.IsValidIndex(TapIndex) ? Names[TapIndex] : NAME_None;
+}
+
+FName UAcousticSourceComponent::GetReflectionTapGainParamName(int32 TapIndex)
+{
+    static const TArray<FName> Names = MakeReflectionTapParamNames(TEXT("Gain"));
+    return Names.IsValidIndex(TapIndex) ? Names[TapIndex] : NAME_None;
+}
+
+FName UAcousticSourceComponent::GetReflectionTapLPFParamName(int32 TapIndex)
+{
+    static const TArray<FName> Names = MakeReflectionTapParamNames(TEXT("LPFCutoff"));
+    return Names.IsValidIndex(TapIndex) ? Names[TapIndex] : NAME_None;
+}
+
 bool UAcousticSourceComponent::IsAudible() const
 {
     if (!bIsRegistered)
@@ -338,43 +446,29 @@ bool UAcousticSourceComponent::IsAudible() const
 void UAcousticSourceComponent::OnParamsUpdated(const FAcousticSourceParams& NewParams)
 {
     CurrentParams = NewParams;
+    ApplyParamsToAudio();
 }
 
 float UAcousticSourceComponent::ComputePriorityScore(const FVector& ListenerLocation) const
 {
-    // Custom priority override
-    if (PriorityOverride >= 0.0f)
-    {
-        return PriorityOverride;
-    }
-
-    float Distance = FMath::Max(FVector::Dist(GetAcousticLocation(), ListenerLocation), 1.0f);
-
-    // Base priority from loudness and distance
-    float DistanceFactor = 1.0f / (Distance / 100.0f); // Normalize to meters
-    float Priority = BaseLoudness * DistanceFactor;
-
-    // Apply importance multiplier
-    int32 ImportanceIndex = static_cast<int32>(Importance);
-    if (ImportanceIndex >= 0 && ImportanceIndex < 4)
-    {
-        static const float ImportanceMultipliers[] = { 0.25f, 1.0f, 2.0f, 10.0f };
-        Priority *= ImportanceMultipliers[ImportanceIndex];
-    }
-
-    // Hero sources get massive boost
-    if (HasFlag(EAcousticSourceFlags::IsHero))
-    {
-        Priority *= 100.0f;
-    }
+    return ComputePriorityScoreForDistance(FVector::Dist(GetAcousticLocation(), ListenerLocation));
+}
 
-    // Critical importance gets infinite priority
-    if (Importance == EAcousticImportance::Critical)
-    {
-        Priority = FLT_MAX;
-    }
+float UAcousticSourceComponent::ComputePriorityScoreForDistance(float Distance) const
+{
+    return GetPriorityInputs().ComputeScore(Distance);
+}
 
-    return Priority;
+FAcousticSourcePriorityInputs UAcousticSourceComponent::GetPriorityInputs() const
+{
+    FAcousticSourcePriorityInputs Inputs;
+    Inputs.RequestedLOD = AcousticLOD;
+    Inputs.Importance = Importance;
+    Inputs.BaseLoudness = BaseLoudness;
+    Inputs.PriorityOverride = PriorityOverride;
+    Inputs.bIsHero = HasFlag(EAcousticSourceFlags::IsHero);
+    Inputs.bIsValid = true;
+    return Inputs;
 }
 
 FVector UAcousticSourceComponent::GetAcousticLocation() const
@@ -0,0 +1,140 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticSourceGrid.h"
+
+// ============================================================================
+// UPDATE
+// ============================================================================
+
+void FAcousticSourceGrid::Reset()
+{
+    Cells.Reset();
+    SourceCells.Reset();
+}
+
+void FAcousticSourceGrid::SetCellSize(float InCellSize)
+{
+    Reset();
+    CellSize = FMath::Max(InCellSize, 100.0f);
+}
+
+void FAcousticSourceGrid::Update(int32 SourceId, const FVector& Location)
+{
+    const FIntVector NewCell = GetCell(Location);
+
+    if (FIntVector* CurrentCell = SourceCells.Find(SourceId))
+    {
+        // Moved inside its cell - only the stored location changes
+        if (*CurrentCell == NewCell)
+        {
+            for (FEntry& Entry : Cells.FindChecked(NewCell))
+            {
+                if (Entry.SourceId == SourceId)
+                {
+                    Entry.Location = Location;
+                    return;
+                }
+            }
+        }
+
+        RemoveFromCell(*CurrentCell, SourceId);
+        *CurrentCell = NewCell;
+    }
+    else
+    {
+        SourceCells.Add(SourceId, NewCell);
+    }
+
+    FEntry& Entry = Cells.FindOrAdd(NewCell).AddDefaulted_GetRef();
+    Entry.SourceId = SourceId;
+    Entry.Location = Location;
+}
+
+bool FAcousticSourceGrid::IsInCellOf(int32 SourceId, const FVector& Location) const
+{
+    const FIntVector* Cell = SourceCells.Find(SourceId);
+    return Cell && *Cell == GetCell(Location);
+}
+
+bool FAcousticSourceGrid::Remove(int32 SourceId)
+{
+    FIntVector Cell;
+    if (!SourceCells.RemoveAndCopyValue(SourceId, Cell))
+    {
+        return false;
+    }
+
+    RemoveFromCell(Cell, SourceId);
+    return true;
+}
+
+void FAcousticSourceGrid::RemoveFromCell(const FIntVector& Cell, int32 SourceId)
+{
+    TArray<FEntry>* Entries = Cells.Find(Cell);
+    if (!Entries)
+    {
+        return;
+    }
+
+    const int32 Index = Entries->IndexOfByPredicate([SourceId](const FEntry& Entry) {
+        return Entry.SourceId == SourceId;
+    });
+    if (Index != INDEX_NONE)
+    {
+        Entries->RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+
+    // Empty cells would pile up along every path a source ever took
+    if (Entries->Num() == 0)
+    {
+        Cells.Remove(Cell);
+    }
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+void FAcousticSourceGrid::GatherInRadius(const FVector& Center, float Radius, TArray<int32>& OutSourceIds) const
+{
+    if (Cells.Num() == 0 || Radius < 0.0f)
+    {
+        return;
+    }
+
+    const FIntVector MinCell = GetCell(Center - FVector(Radius));
+    const FIntVector MaxCell = GetCell(Center + FVector(Radius));
+    const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+            {
+                const TArray<FEntry>* Entries = Cells.Find(FIntVector(X, Y, Z));
+                if (!Entries)
+                {
+                    continue;
+                }
+
+                for (const FEntry& Entry : *Entries)
+                {
+                    if (FVector::DistSquared(Entry.Location, Center) <= RadiusSq)
+                    {
+                        OutSourceIds.Add(Entry.SourceId);
+                    }
+                }
+            }
+        }
+    }
+}
+
+FIntVector FAcousticSourceGrid::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize)
+    );
+}
@@ -0,0 +1,201 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticSourceRegistry.h"
+#include "AcousticSourceComponent.h"
+#include "AcousticPortalGraph.h"
+
+// ============================================================================
+// PRIORITY
+// ============================================================================
+
+float FAcousticSourcePriorityInputs::ComputeScore(float Distance) const
+{
+    // Custom priority override
+    if (PriorityOverride >= 0.0f)
+    {
+        return PriorityOverride;
+    }
+
+    // Critical importance gets infinite priority
+    if (Importance == EAcousticImportance::Critical)
+    {
+        return FLT_MAX;
+    }
+
+    Distance = FMath::Max(Distance, 1.0f);
+
+    // Base priority from loudness and distance
+    float DistanceFactor = 1.0f / (Distance / 100.0f); // Normalize to meters
+    float Priority = BaseLoudness * DistanceFactor;
+
+    // Apply importance multiplier
+    int32 ImportanceIndex = static_cast<int32>(Importance);
+    if (ImportanceIndex >= 0 && ImportanceIndex < 4)
+    {
+        static const float ImportanceMultipliers[] = { 0.25f, 1.0f, 2.0f, 10.0f };
+        Priority *= ImportanceMultipliers[ImportanceIndex];
+    }
+
+    // Hero sources get massive boost
+    if (bIsHero)
+    {
+        Priority *= 100.0f;
+    }
+
+    return Priority;
+}
+
+// ============================================================================
+// REGISTRATION
+// ============================================================================
+
+int32 FAcousticSourceRegistry::Add(UAcousticSourceComponent* Component)
+{
+    // Reuse a free slot, otherwise grow the slot table
+    int32 Slot;
+    if (FreeSlots.Num() > 0)
+    {
+        Slot = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Slot = SlotGenerations.Add(1);
+        SlotToDense.Add(INDEX_NONE);
+        check(Slot <= AcousticSourceHandle::IndexMask);
+    }
+
+    const int32 SourceId = AcousticSourceHandle::Make(Slot, SlotGenerations[Slot]);
+    const int32 DenseIndex = SourceIds.Add(SourceId);
+    SlotToDense[Slot] = DenseIndex;
+
+    Positions.Add(Component ? Component->GetAcousticLocation() : FVector::ZeroVector);
+    Distances.Add(0.0f);
+    ZoneNodes.Add(FAcousticPortalGraph::OutsideNode);
+    PriorityInputs.Add(Component ? Component->GetPriorityInputs() : FAcousticSourcePriorityInputs());
+    PriorityScores.Add(0.0f);
+    EffectiveLODs.Add(EAcousticLOD::Off); // Until a listener gathers it
+    LastOcclusionUpdateTimes.Add(0.0);
+    OcclusionDeficits.Add(0.0f);
+    LastReflectionUpdateTimes.Add(0.0);
+    NextOcclusionUpdateTimes.Add(0.0);
+    NextReflectionUpdateTimes.Add(0.0);
+
+    // Spread phases with a multiplicative hash of the ID
+    const uint32 PhaseHash = static_cast<uint32>(SourceId) * 2654435761u;
+    UpdatePhases.Add(((PhaseHash >> 8) + 1) / static_cast<float>(1 << 24));
+    AudibleFlags.Add(false);
+    ZoneCulledFlags.Add(false);
+    GatherStamps.Add(0);
+    MovedFlags.Add(false);
+    OcclusionSourceOrigins.Add(FVector::ZeroVector);
+    OcclusionListenerOrigins.Add(FVector::ZeroVector);
+    OcclusionCacheValid.Add(false);
+
+    Components.Add(Component);
+    FAcousticSourceColdData& Cold = ColdData.AddDefaulted_GetRef();
+    Cold.CurrentParams.Reset();
+    Cold.PreviousParams.Reset();
+    Cold.AppliedParams.Reset();
+
+    return SourceId;
+}
+
+bool FAcousticSourceRegistry::Remove(int32 SourceId)
+{
+    const int32 DenseIndex = FindDense(SourceId);
+    if (DenseIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const int32 Slot = AcousticSourceHandle::GetSlot(SourceId);
+
+    // Bump the generation so stale IDs for this slot stop resolving
+    SlotGenerations[Slot] = FMath::Max(1, (SlotGenerations[Slot] + 1) & AcousticSourceHandle::GenerationMask);
+    SlotToDense[Slot] = INDEX_NONE;
+    FreeSlots.Add(Slot);
+
+    RemoveDenseAtSwap(DenseIndex);
+    return true;
+}
+
+int32 FAcousticSourceRegistry::FindDense(int32 SourceId) const
+{
+    if (SourceId < 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Slot = AcousticSourceHandle::GetSlot(SourceId);
+    if (!SlotGenerations.IsValidIndex(Slot) ||
+        SlotGenerations[Slot] != AcousticSourceHandle::GetGeneration(SourceId))
+    {
+        return INDEX_NONE;
+    }
+
+    return SlotToDense[Slot];
+}
+
+void FAcousticSourceRegistry::Reset()
+{
+    SourceIds.Reset();
+    Positions.Reset();
+    Distances.Reset();
+    ZoneNodes.Reset();
+    PriorityInputs.Reset();
+    PriorityScores.Reset();
+    EffectiveLODs.Reset();
+    LastOcclusionUpdateTimes.Reset();
+    OcclusionDeficits.Reset();
+    LastReflectionUpdateTimes.Reset();
+    NextOcclusionUpdateTimes.Reset();
+    NextReflectionUpdateTimes.Reset();
+    UpdatePhases.Reset();
+    AudibleFlags.Reset();
+    ZoneCulledFlags.Reset();
+    GatherStamps.Reset();
+    MovedFlags.Reset();
+    OcclusionSourceOrigins.Reset();
+    OcclusionListenerOrigins.Reset();
+    OcclusionCacheValid.Reset();
+    Components.Reset();
+    ColdData.Reset();
+
+    SlotGenerations.Reset();
+    SlotToDense.Reset();
+    FreeSlots.Reset();
+}
+
+void FAcousticSourceRegistry::RemoveDenseAtSwap(int32 DenseIndex)
+{
+    const int32 LastIndex = SourceIds.Num() - 1;
+
+    // The last element moves into the hole - repoint its slot
+    if (DenseIndex != LastIndex)
+    {
+        SlotToDense[AcousticSourceHandle::GetSlot(SourceIds[LastIndex])] = DenseIndex;
+    }
+
+    SourceIds.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    Positions.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    Distances.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    ZoneNodes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    PriorityInputs.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    PriorityScores.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    EffectiveLODs.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    LastOcclusionUpdateTimes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    OcclusionDeficits.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    LastReflectionUpdateTimes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    NextOcclusionUpdateTimes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    NextReflectionUpdateTimes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    UpdatePhases.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    AudibleFlags.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    ZoneCulledFlags.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    GatherStamps.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    MovedFlags.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    OcclusionSourceOrigins.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    OcclusionListenerOrigins.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    OcclusionCacheValid.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    Components.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    ColdData.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+}
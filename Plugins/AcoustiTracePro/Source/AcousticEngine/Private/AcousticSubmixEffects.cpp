@@ -62,25 +62,29 @@ void FAcousticZoneReverbEffect::OnPresetChanged()
     }
     else
     {
-        // Start blending
-        bIsBlending = true;
-        BlendProgress = 0.0f;
+        StartBlend();
     }
 }
 
 void FAcousticZoneReverbEffect::SetTargetSettings(const FAcousticZoneReverbSettings& InSettings)
 {
     TargetSettings = InSettings;
+    StartBlend();
+}
+
+void FAcousticZoneReverbEffect::StartBlend()
+{
+    // Linear ramp from the current settings, restarted from zero on every new target
+    BlendAlpha.Init(SampleRate, FMath::Max(CurrentSettings.BlendTime, 0.01f));
+    BlendAlpha.SetValue(0.0f);
+    BlendAlpha.SetTarget(1.0f);
     bIsBlending = true;
-    BlendProgress = 0.0f;
 }
 
 void FAcousticZoneReverbEffect::InitializeDSP()
 {
-    // Initialize pre-delay buffer (up to 100ms)
-    int32 MaxPreDelaySamples = FMath::CeilToInt(SampleRate * 0.1f);
-    PreDelayBuffer.SetNumZeroed(MaxPreDelaySamples * NumChannels);
-    PreDelayWriteIndex = 0;
+    // Initialize pre-delay line (early taps up to 200ms at large room sizes)
+    PreDelayLine.Init(FMath::CeilToInt(SampleRate * 0.2f));
 
     // Initialize early reflection taps
     EarlyTaps.SetNum(8);
@@ -95,28 +99,21 @@ void FAcousticZoneReverbEffect::InitializeDSP()
         EarlyTaps[i].Pan = TapPans[i];
     }
 
-    // Initialize allpass diffusers
+    // Initialize allpass diffusers. The tuning was voiced with a ring of
+    // Delay * NumChannels samples read one slot ahead of the write, so that
+    // length minus one is the delay the reverb's density and colour expect.
     int32 DiffuserDelays[] = { 142, 107, 379, 277 };
     Diffusers.SetNum(4);
     for (int32 i = 0; i < 4; i++)
     {
-        Diffusers[i].Buffer.SetNumZeroed(DiffuserDelays[i] * NumChannels);
-        Diffusers[i].WriteIndex = 0;
-        Diffusers[i].Feedback = 0.5f;
+        FAllpassDiffuser& Diffuser = Diffusers[i];
+        Diffuser.Delay = FMath::Max(DiffuserDelays[i] * NumChannels - 1, 1);
+        Diffuser.Line.Init(Diffuser.Delay);
+        Diffuser.Feedback = 0.5f;
     }
 
-    // Initialize FDN tanks (4 tanks for simple reverb)
-    int32 TankDelays[] = { 1557, 1617, 1491, 1422 };
-    FDNTanks.SetNum(4);
-    for (int32 i = 0; i < 4; i++)
-    {
-        int32 DelaySize = FMath::CeilToInt(TankDelays[i] * (SampleRate / 44100.0f));
-        FDNTanks[i].Buffer.SetNumZeroed(DelaySize * NumChannels);
-        FDNTanks[i].WriteIndex = 0;
-        FDNTanks[i].Feedback = 0.0f; // Will be calculated from RT60
-        FDNTanks[i].LPFState = 0.0f;
-        FDNTanks[i].HPFState = 0.0f;
-    }
+    // Eight-line FDN for the late tail
+    LateFDN.Init(SampleRate);
 }
 
 void FAcousticZoneReverbEffect::OnProcessAudio(const FSoundEffectSubmixInputData& InData, FSoundEffectSubmixOutputData& OutData)
@@ -134,33 +131,41 @@ void FAcousticZoneReverbEffect::OnProcessAudio(const FSoundEffectSubmixInputData
 
     // Get current settings (interpolated if blending)
     FAcousticZoneReverbSettings ActiveSettings = bIsBlending ?
-        InterpolateSettings(BlendProgress) : CurrentSettings;
+        InterpolateSettings(BlendAlpha.GetValue()) : CurrentSettings;
 
     // Calculate derived parameters
     float DryMix = 1.0f - ActiveSettings.WetLevel;
     float WetMix = ActiveSettings.WetLevel;
 
-    // Process each frame
+    EarlyScratchL.SetNumUninitialized(NumFrames, EAllowShrinking::No);
+    EarlyScratchR.SetNumUninitialized(NumFrames, EAllowShrinking::No);
+    LateInputScratch.SetNumUninitialized(NumFrames, EAllowShrinking::No);
+    LateScratchL.SetNumUninitialized(NumFrames, EAllowShrinking::No);
+    LateScratchR.SetNumUninitialized(NumFrames, EAllowShrinking::No);
+
+    // Sum to mono for the reverb input
     for (int32 Frame = 0; Frame < NumFrames; Frame++)
     {
-        // Get input sample (sum to mono for reverb input)
-        float InputL = InBuffer[Frame * NumChannels];
-        float InputR = NumChannels > 1 ? InBuffer[Frame * NumChannels + 1] : InputL;
-        float MonoInput = (InputL + InputR) * 0.5f;
+        const float InputL = InBuffer[Frame * NumChannels];
+        const float InputR = NumChannels > 1 ? InBuffer[Frame * NumChannels + 1] : InputL;
+        LateInputScratch[Frame] = (InputL + InputR) * 0.5f;
+    }
+
+    // Early taps, part of which also feeds the late tail
+    ProcessEarlyReflections(LateInputScratch.GetData(), EarlyScratchL.GetData(), EarlyScratchR.GetData(), NumFrames, ActiveSettings);
+    Audio::ArrayMultiplyAddInPlace(EarlyScratchL, 0.3f, LateInputScratch);
 
-        // Early reflections
-        float EarlyL = 0.0f;
-        float EarlyR = 0.0f;
-        ProcessEarlyReflectionsSample(MonoInput, EarlyL, EarlyR, ActiveSettings);
+    // Late reverb via FDN, one block at a time
+    ProcessLateReverb(LateInputScratch.GetData(), LateScratchL.GetData(), LateScratchR.GetData(), NumFrames, ActiveSettings);
 
-        // Late reverb via FDN
-        float LateL = 0.0f;
-        float LateR = 0.0f;
-        ProcessLateReverbSample(MonoInput + EarlyL * 0.3f, LateL, LateR, ActiveSettings);
+    for (int32 Frame = 0; Frame < NumFrames; Frame++)
+    {
+        const float InputL = InBuffer[Frame * NumChannels];
+        const float InputR = NumChannels > 1 ? InBuffer[Frame * NumChannels + 1] : InputL;
 
         // Mix wet signals
-        float WetL = (EarlyL * ActiveSettings.EarlyLevel + LateL * ActiveSettings.LateLevel);
-        float WetR = (EarlyR * ActiveSettings.EarlyLevel + LateR * ActiveSettings.LateLevel);
+        float WetL = (EarlyScratchL[Frame] * ActiveSettings.EarlyLevel + LateScratchL[Frame] * ActiveSettings.LateLevel);
+        float WetR = (EarlyScratchR[Frame] * ActiveSettings.EarlyLevel + LateScratchR[Frame] * ActiveSettings.LateLevel);
 
         // Apply stereo width
         float Mid = (WetL + WetR) * 0.5f;
@@ -177,118 +182,65 @@ void FAcousticZoneReverbEffect::OnProcessAudio(const FSoundEffectSubmixInputData
     }
 }
 
-void FAcousticZoneReverbEffect::ProcessEarlyReflections(const float* InBuffer, float* OutBuffer, int32 NumFrames)
+void FAcousticZoneReverbEffect::ProcessEarlyReflections(const float* MonoInput, float* OutL, float* OutR, int32 NumFrames, const FAcousticZoneReverbSettings& Settings)
 {
-    // Batch processing version - simplified for clarity
-    FMemory::Memcpy(OutBuffer, InBuffer, NumFrames * NumChannels * sizeof(float));
-}
+    PreDelayLine.WriteBlock(MonoInput, NumFrames);
 
-void FAcousticZoneReverbEffect::ProcessEarlyReflectionsSample(float Input, float& OutL, float& OutR, const FAcousticZoneReverbSettings& Settings)
-{
-    OutL = 0.0f;
-    OutR = 0.0f;
+    FMemory::Memzero(OutL, NumFrames * sizeof(float));
+    FMemory::Memzero(OutR, NumFrames * sizeof(float));
+    EarlyTapScratch.SetNumUninitialized(NumFrames, EAllowShrinking::No);
 
-    // Write to pre-delay buffer
-    int32 PreDelaySamples = FMath::RoundToInt(Settings.PreDelayMs * SampleRate / 1000.0f);
-    PreDelaySamples = FMath::Clamp(PreDelaySamples, 1, PreDelayBuffer.Num() - 1);
+    const TArrayView<float> OutLView(OutL, NumFrames);
+    const TArrayView<float> OutRView(OutR, NumFrames);
 
-    PreDelayBuffer[PreDelayWriteIndex] = Input;
-    int32 ReadIndex = (PreDelayWriteIndex - PreDelaySamples + PreDelayBuffer.Num()) % PreDelayBuffer.Num();
-    float DelayedInput = PreDelayBuffer[ReadIndex];
-    PreDelayWriteIndex = (PreDelayWriteIndex + 1) % PreDelayBuffer.Num();
+    // A delay of one is the current sample; the whole block must still be in the line
+    const int32 MaxTapDelay = PreDelayLine.GetCapacity() - NumFrames + 1;
 
-    // Sum early reflection taps
+    // Sum early reflection taps, one block copy per tap
     for (const FEarlyTap& Tap : EarlyTaps)
     {
         int32 TapDelaySamples = FMath::RoundToInt(Tap.DelayMs * Settings.RoomSize * SampleRate / 1000.0f);
-        TapDelaySamples = FMath::Clamp(TapDelaySamples, 1, PreDelayBuffer.Num() - 1);
+        TapDelaySamples = FMath::Clamp(TapDelaySamples, 1, MaxTapDelay);
 
-        int32 TapReadIndex = (PreDelayWriteIndex - TapDelaySamples + PreDelayBuffer.Num()) % PreDelayBuffer.Num();
-        float TapSample = PreDelayBuffer[TapReadIndex] * Tap.Gain * Settings.Density;
+        // The block's first frame was written NumFrames writes ago
+        PreDelayLine.ReadBlock(NumFrames + TapDelaySamples - 1, EarlyTapScratch.GetData(), NumFrames);
 
         // Pan
-        float LeftGain = 0.5f - Tap.Pan * 0.5f;
-        float RightGain = 0.5f + Tap.Pan * 0.5f;
+        const float TapGain = Tap.Gain * Settings.Density;
+        const float LeftGain = 0.5f - Tap.Pan * 0.5f;
+        const float RightGain = 0.5f + Tap.Pan * 0.5f;
 
-        OutL += TapSample * LeftGain;
-        OutR += TapSample * RightGain;
+        Audio::ArrayMultiplyAddInPlace(EarlyTapScratch, TapGain * LeftGain, OutLView);
+        Audio::ArrayMultiplyAddInPlace(EarlyTapScratch, TapGain * RightGain, OutRView);
     }
 }
 
-void FAcousticZoneReverbEffect::ProcessLateReverb(const float* InBuffer, float* OutBuffer, int32 NumFrames)
+void FAcousticZoneReverbEffect::ProcessLateReverb(float* InOutLateInput, float* OutL, float* OutR, int32 NumFrames, const FAcousticZoneReverbSettings& Settings)
 {
-    // Batch processing version
-    FMemory::Memcpy(OutBuffer, InBuffer, NumFrames * NumChannels * sizeof(float));
-}
+    // Coefficients are per block; the FDN skips the work when nothing changed
+    LateFDN.SetDecay(Settings.RT60, Settings.HFDecay, Settings.LFDecay);
 
-void FAcousticZoneReverbEffect::ProcessLateReverbSample(float Input, float& OutL, float& OutR, const FAcousticZoneReverbSettings& Settings)
-{
-    // Calculate feedback from RT60
-    // Feedback = 10^(-3 * DelayTime / RT60)
-    float AvgDelayTime = 0.035f * Settings.RoomSize; // ~35ms average delay scaled by room
-    float Feedback = FMath::Pow(10.0f, -3.0f * AvgDelayTime / FMath::Max(Settings.RT60, 0.1f));
-    Feedback = FMath::Clamp(Feedback, 0.0f, 0.99f);
-
-    // Calculate filter coefficients from HF/LF decay
-    float HFDamping = 1.0f - Settings.HFDecay * 0.5f;
-    float LFDamping = 1.0f - Settings.LFDecay * 0.5f;
-
-    // Apply input through diffusers
-    float DiffusedInput = Input;
+    // Diffusers run in series, one pass over the block each
+    const float Diffusion = Settings.Diffusion;
     for (FAllpassDiffuser& Diffuser : Diffusers)
     {
-        int32 BufferSize = Diffuser.Buffer.Num();
-        if (BufferSize > 0)
-        {
-            int32 ReadIndex = (Diffuser.WriteIndex + 1) % BufferSize;
-            float DelayedSample = Diffuser.Buffer[ReadIndex];
+        FAcousticDelayLine& Line = Diffuser.Line;
+        const int32 Delay = Diffuser.Delay;
+        const float Feedback = Diffuser.Feedback;
 
-            float OutputSample = -DiffusedInput * Diffuser.Feedback + DelayedSample;
-            Diffuser.Buffer[Diffuser.WriteIndex] = DiffusedInput + DelayedSample * Diffuser.Feedback;
-            Diffuser.WriteIndex = (Diffuser.WriteIndex + 1) % BufferSize;
-
-            DiffusedInput = OutputSample * Settings.Diffusion + DiffusedInput * (1.0f - Settings.Diffusion);
-        }
-    }
+        for (int32 Frame = 0; Frame < NumFrames; Frame++)
+        {
+            const float Input = InOutLateInput[Frame];
+            const float DelayedSample = Line.Read(Delay);
 
-    // Process through FDN tanks
-    float TankOutputs[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            const float OutputSample = -Input * Feedback + DelayedSample;
+            Line.Write(Input + DelayedSample * Feedback);
 
-    for (int32 i = 0; i < 4; i++)
-    {
-        FFDNTank& Tank = FDNTanks[i];
-        int32 BufferSize = Tank.Buffer.Num();
-        if (BufferSize > 0)
-        {
-            // Read from delay
-            int32 ReadIndex = (Tank.WriteIndex + 1) % BufferSize;
-            float DelayedSample = Tank.Buffer[ReadIndex];
-
-            // Apply damping filters
-            // Simple one-pole LPF: y[n] = (1-a)*x[n] + a*y[n-1]
-            Tank.LPFState = (1.0f - HFDamping) * DelayedSample + HFDamping * Tank.LPFState;
-            // Simple one-pole HPF: y[n] = a*(y[n-1] + x[n] - x[n-1])
-            float HPFInput = Tank.LPFState;
-            float HPFOutput = LFDamping * (Tank.HPFState + HPFInput);
-            Tank.HPFState = HPFOutput - HPFInput;
-
-            TankOutputs[i] = HPFOutput;
-
-            // Write to delay with feedback
-            float FeedbackSum = DiffusedInput;
-            // Hadamard-like mixing (simplified)
-            FeedbackSum += TankOutputs[(i + 1) % 4] * 0.5f;
-            FeedbackSum += TankOutputs[(i + 2) % 4] * -0.5f;
-            FeedbackSum += TankOutputs[(i + 3) % 4] * 0.5f;
-
-            Tank.Buffer[Tank.WriteIndex] = FeedbackSum * Feedback;
-            Tank.WriteIndex = (Tank.WriteIndex + 1) % BufferSize;
+            InOutLateInput[Frame] = OutputSample * Diffusion + Input * (1.0f - Diffusion);
         }
     }
 
-    // Sum tank outputs to stereo (decorrelated)
-    OutL = (TankOutputs[0] + TankOutputs[2]) * 0.5f;
-    OutR = (TankOutputs[1] + TankOutputs[3]) * 0.5f;
+    LateFDN.ProcessBlock(InOutLateInput, OutL, OutR, NumFrames);
 }
 
 void FAcousticZoneReverbEffect::UpdateBlend(int32 NumFrames)
@@ -298,13 +250,10 @@ void FAcousticZoneReverbEffect::UpdateBlend(int32 NumFrames)
         return;
     }
 
-    float BlendTime = FMath::Max(CurrentSettings.BlendTime, 0.01f);
-    float FrameTime = NumFrames / SampleRate;
-    BlendProgress += FrameTime / BlendTime;
+    BlendAlpha.Advance(NumFrames);
 
-    if (BlendProgress >= 1.0f)
+    if (BlendAlpha.IsSettled())
     {
-        BlendProgress = 1.0f;
         CurrentSettings = TargetSettings;
         bIsBlending = false;
     }
@@ -340,9 +289,8 @@ void FHeadphoneCrossfeedEffect::Init(const FSoundEffectSubmixInitData& InitData)
 
     // Initialize delay lines for crossfeed (~300us max)
     int32 MaxDelaySamples = FMath::CeilToInt(SampleRate * 0.0005f);
-    CrossfeedDelayL.SetNumZeroed(MaxDelaySamples);
-    CrossfeedDelayR.SetNumZeroed(MaxDelaySamples);
-    DelayWriteIndex = 0;
+    CrossfeedLineL.Init(MaxDelaySamples);
+    CrossfeedLineR.Init(MaxDelaySamples);
 }
 
 void FHeadphoneCrossfeedEffect::OnPresetChanged()
@@ -375,7 +323,7 @@ void FHeadphoneCrossfeedEffect::OnProcessAudio(const FSoundEffectSubmixInputData
 
     // Calculate delay in samples from microseconds
     int32 DelaySamples = FMath::RoundToInt(CurrentSettings.CrossfeedDelayUs * SampleRate / 1000000.0f);
-    DelaySamples = FMath::Clamp(DelaySamples, 1, CrossfeedDelayL.Num() - 1);
+    DelaySamples = FMath::Clamp(DelaySamples, 1, CrossfeedLineL.GetCapacity());
 
     // Calculate LPF coefficient
     float LPFFreq = CurrentSettings.CrossfeedLPFHz;
@@ -389,14 +337,11 @@ void FHeadphoneCrossfeedEffect::OnProcessAudio(const FSoundEffectSubmixInputData
         float InL = InBuffer[Frame * NumChannels];
         float InR = InBuffer[Frame * NumChannels + 1];
 
-        // Write to delay lines
-        CrossfeedDelayL[DelayWriteIndex] = InL;
-        CrossfeedDelayR[DelayWriteIndex] = InR;
-
-        // Read delayed samples for crossfeed
-        int32 ReadIndex = (DelayWriteIndex - DelaySamples + CrossfeedDelayL.Num()) % CrossfeedDelayL.Num();
-        float DelayedL = CrossfeedDelayL[ReadIndex];
-        float DelayedR = CrossfeedDelayR[ReadIndex];
+        // Read delayed samples for crossfeed, then write the new ones
+        float DelayedL = CrossfeedLineL.Read(DelaySamples);
+        float DelayedR = CrossfeedLineR.Read(DelaySamples);
+        CrossfeedLineL.Write(InL);
+        CrossfeedLineR.Write(InR);
 
         // Apply LPF to crossfeed
         CrossfeedLPFStateL = LPFCoeff * CrossfeedLPFStateL + (1.0f - LPFCoeff) * DelayedR;
@@ -408,8 +353,6 @@ void FHeadphoneCrossfeedEffect::OnProcessAudio(const FSoundEffectSubmixInputData
             CrossfeedLPFStateL * CrossfeedAmount;
         OutBuffer[Frame * NumChannels + 1] = InR * (1.0f - CrossfeedAmount * 0.5f) +
             CrossfeedLPFStateR * CrossfeedAmount;
-
-        DelayWriteIndex = (DelayWriteIndex + 1) % CrossfeedDelayL.Num();
     }
 }
 
@@ -422,13 +365,24 @@ void FAcousticMasterEffect::Init(const FSoundEffectSubmixInitData& InitData)
     SampleRate = InitData.SampleRate;
     LimiterEnvelope = 0.0f;
     LimiterGain = 1.0f;
-    SmoothedOutputGain = 1.0f;
+
+    // Limiter attack/release
+    AttackCoeff = FMath::Exp(-1.0f / (SampleRate * 0.001f)); // 1ms attack
+    ReleaseCoeff = FMath::Exp(-1.0f / (SampleRate * 0.1f));  // 100ms release
+
+    // Gain smoothing
+    OutputGain.Init(SampleRate, 0.01f, EAcousticRampType::Exponential); // 10ms smoothing
+    OutputGain.SetValue(1.0f);
 }
 
 void FAcousticMasterEffect::OnPresetChanged()
 {
     UAcousticMasterPreset* Preset = CastChecked<UAcousticMasterPreset>(GetPreset());
     CurrentSettings = Preset->Settings;
+
+    // dB conversions happen here, not on the audio thread every block
+    OutputGain.SetTarget(FMath::Pow(10.0f, CurrentSettings.OutputGainDb / 20.0f));
+    LimiterThreshold = FMath::Pow(10.0f, CurrentSettings.LimiterThresholdDb / 20.0f);
 }
 
 void FAcousticMasterEffect::OnProcessAudio(const FSoundEffectSubmixInputData& InData, FSoundEffectSubmixOutputData& OutData)
@@ -445,23 +399,14 @@ void FAcousticMasterEffect::OnProcessAudio(const FSoundEffectSubmixInputData& In
     const int32 NumFrames = InData.NumFrames;
     const int32 NumChannels = InData.NumChannels;
 
-    // Calculate target gain from dB
-    float TargetGain = FMath::Pow(10.0f, CurrentSettings.OutputGainDb / 20.0f);
-
-    // Limiter threshold
-    float LimiterThreshold = FMath::Pow(10.0f, CurrentSettings.LimiterThresholdDb / 20.0f);
-
-    // Limiter attack/release
-    float AttackCoeff = FMath::Exp(-1.0f / (SampleRate * 0.001f)); // 1ms attack
-    float ReleaseCoeff = FMath::Exp(-1.0f / (SampleRate * 0.1f));  // 100ms release
-
-    // Gain smoothing
-    float GainSmoothCoeff = FMath::Exp(-1.0f / (SampleRate * 0.01f)); // 10ms smoothing
+    // Output gain ramps linearly across the block
+    OutputGain.Advance(NumFrames);
+    float SmoothedOutputGain = OutputGain.GetBlockStart();
+    const float OutputGainStep = OutputGain.GetBlockStep();
 
     for (int32 Frame = 0; Frame < NumFrames; Frame++)
     {
-        // Smooth output gain
-        SmoothedOutputGain = GainSmoothCoeff * SmoothedOutputGain + (1.0f - GainSmoothCoeff) * TargetGain;
+        SmoothedOutputGain += OutputGainStep;
 
         // Get max absolute value across channels
         float MaxAbs = 0.0f;
@@ -0,0 +1,142 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticZoneIndex.h"
+#include "AcousticZoneVolume.h"
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+void FAcousticZoneIndex::Build(const TArray<TWeakObjectPtr<AAcousticZoneVolume>>& Zones, float InCellSize)
+{
+    Reset();
+    CellSize = FMath::Max(InCellSize, 100.0f);
+
+    for (const TWeakObjectPtr<AAcousticZoneVolume>& ZonePtr : Zones)
+    {
+        AAcousticZoneVolume* Zone = ZonePtr.Get();
+        if (!Zone)
+        {
+            continue;
+        }
+
+        FVector Origin, Extent;
+        Zone->GetActorBounds(false, Origin, Extent);
+
+        FIndexedZone& Indexed = IndexedZones.AddDefaulted_GetRef();
+        Indexed.Zone = Zone;
+        Indexed.Bounds = FBox(Origin - Extent, Origin + Extent);
+        Indexed.Priority = Zone->Priority;
+    }
+
+    // Rasterize in rank order so every cell list comes out sorted; equal
+    // priorities keep registration order, as the linear zone scan did
+    TArray<int32> Order;
+    Order.Reserve(IndexedZones.Num());
+    for (int32 i = 0; i < IndexedZones.Num(); i++)
+    {
+        Order.Add(i);
+    }
+    Order.Sort([this](int32 A, int32 B) {
+        return Outranks(A, B);
+    });
+
+    for (const int32 ZoneIndex : Order)
+    {
+        const FBox& Bounds = IndexedZones[ZoneIndex].Bounds;
+        const FIntVector MinCell = GetCell(Bounds.Min);
+        const FIntVector MaxCell = GetCell(Bounds.Max);
+        const int64 NumCells =
+            int64(MaxCell.X - MinCell.X + 1) *
+            int64(MaxCell.Y - MinCell.Y + 1) *
+            int64(MaxCell.Z - MinCell.Z + 1);
+
+        if (NumCells > MaxCellsPerZone)
+        {
+            OversizeZones.Add(ZoneIndex);
+            continue;
+        }
+
+        for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+        {
+            for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+            {
+                for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+                {
+                    Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(ZoneIndex);
+                }
+            }
+        }
+    }
+}
+
+void FAcousticZoneIndex::Reset()
+{
+    IndexedZones.Reset();
+    Cells.Reset();
+    OversizeZones.Reset();
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+AAcousticZoneVolume* FAcousticZoneIndex::FindZone(const FVector& Location) const
+{
+    AAcousticZoneVolume* BestZone = nullptr;
+    int32 BestIndex = INDEX_NONE;
+
+    if (const TArray<int32>* CellZones = Cells.Find(GetCell(Location)))
+    {
+        TestCandidates(*CellZones, Location, BestZone, BestIndex);
+    }
+
+    TestCandidates(OversizeZones, Location, BestZone, BestIndex);
+
+    return BestZone;
+}
+
+FIntVector FAcousticZoneIndex::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize)
+    );
+}
+
+bool FAcousticZoneIndex::Outranks(int32 A, int32 B) const
+{
+    const int32 PriorityA = IndexedZones[A].Priority;
+    const int32 PriorityB = IndexedZones[B].Priority;
+    return PriorityA != PriorityB ? PriorityA > PriorityB : A < B;
+}
+
+void FAcousticZoneIndex::TestCandidates(const TArray<int32>& Candidates, const FVector& Location,
+    AAcousticZoneVolume*& BestZone, int32& BestIndex) const
+{
+    for (const int32 ZoneIndex : Candidates)
+    {
+        const FIndexedZone& Indexed = IndexedZones[ZoneIndex];
+
+        // Sorted by rank - nothing further down can win
+        if (BestIndex != INDEX_NONE && !Outranks(ZoneIndex, BestIndex))
+        {
+            return;
+        }
+
+        // Cheap bounds test first, exact brush test last
+        if (!Indexed.Bounds.IsInside(Location))
+        {
+            continue;
+        }
+
+        AAcousticZoneVolume* Zone = Indexed.Zone.Get();
+        if (Zone && Zone->ContainsPoint(Location))
+        {
+            BestZone = Zone;
+            BestIndex = ZoneIndex;
+            return;
+        }
+    }
+}
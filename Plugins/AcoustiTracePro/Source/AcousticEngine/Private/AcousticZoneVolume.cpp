@@ -373,6 +373,8 @@ void AAcousticPortalVolume::SetOpen(bool bOpen)
     {
         Openness = TargetOpenness;
     }
+
+    NotifyEngineOfStateChange();
 }
 
 void AAcousticPortalVolume::SetOpenness(float NewOpenness)
@@ -380,6 +382,8 @@ void AAcousticPortalVolume::SetOpenness(float NewOpenness)
     Openness = FMath::Clamp(NewOpenness, 0.0f, 1.0f);
     TargetOpenness = Openness;
     bIsOpen = Openness > 0.5f;
+
+    NotifyEngineOfStateChange();
 }
 
 float AAcousticPortalVolume::GetCurrentTransmission() const
@@ -468,6 +472,25 @@ void AAcousticPortalVolume::UnregisterFromEngine()
     }
 }
 
+void AAcousticPortalVolume::NotifyEngineOfStateChange()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (UAcousticEngineSubsystem* Subsystem = World->GetSubsystem<UAcousticEngineSubsystem>())
+    {
+        Subsystem->NotifyPortalChanged(this);
+    }
+}
+
+void AAcousticPortalVolume::OnRep_Openness()
+{
+    NotifyEngineOfStateChange();
+}
+
 void AAcousticPortalVolume::DetectConnectedZones()
 {
     if (ZoneA && ZoneB)
@@ -522,6 +545,9 @@ void AAcousticPortalVolume::UpdateTransition(float DeltaTime)
     {
         Openness = TargetOpenness;
         SetActorTickEnabled(false);
+
+        // Transition settled - results traced mid-swing are stale
+        NotifyEngineOfStateChange();
         return;
     }
 
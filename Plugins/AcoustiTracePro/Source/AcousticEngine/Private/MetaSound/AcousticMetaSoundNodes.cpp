@@ -7,6 +7,8 @@
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundPrimitives.h"
 #include "MetasoundAudioBuffer.h"
+#include "AcousticSmoothedValue.h"
+#include "AcousticDelayLine.h"
 
 #define LOCTEXT_NAMESPACE "AcousticMetaSoundNodes"
 
@@ -120,10 +122,14 @@ namespace Metasound
             , GainReductionInput(InGainReduction)
             , AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
             , SampleRate(InSettings.GetSampleRate())
-            , CurrentLPFCoeff(0.0f)
             , FilterState(0.0f)
-            , SmoothedGain(1.0f)
+            , LastLPFCutoff(-1.0f)
+            , LastGainDb(1.0f)
         {
+            LPFCoeff.Init(SampleRate, LPFSmoothingSeconds, EAcousticRampType::Exponential);
+            LPFCoeff.SetValue(0.0f);
+            Gain.Init(SampleRate, GainSmoothingSeconds, EAcousticRampType::Exponential);
+            Gain.SetValue(1.0f);
         }
 
         virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
@@ -150,37 +156,58 @@ namespace Metasound
             const float LPFCutoff = FMath::Clamp(*LPFCutoffInput, 20.0f, 20000.0f);
             const float GainReductionDb = FMath::Clamp(*GainReductionInput, -60.0f, 0.0f);
 
-            // Calculate LPF coefficient (simple one-pole)
-            float TargetLPFCoeff = FMath::Exp(-2.0f * PI * LPFCutoff / SampleRate);
-
-            // Calculate target gain
-            float OcclusionGainDb = -Occlusion * 20.0f; // Up to -20dB from occlusion
-            float TargetGain = FMath::Pow(10.0f, (OcclusionGainDb + GainReductionDb) / 20.0f);
-
-            // Process samples with smoothing
-            float LPFCoeffSmooth = 0.999f;
-            float GainSmooth = 0.9995f;
+            // Transcendentals only run when an input changed, never per sample
+            if (LPFCutoff != LastLPFCutoff)
+            {
+                LastLPFCutoff = LPFCutoff;
+                LPFCoeff.SetTarget(FMath::Exp(-2.0f * PI * LPFCutoff / SampleRate));
+            }
 
-            for (int32 i = 0; i < NumSamples; i++)
+            const float OcclusionGainDb = -Occlusion * 20.0f; // Up to -20dB from occlusion
+            const float GainDb = OcclusionGainDb + GainReductionDb;
+            if (GainDb != LastGainDb)
             {
-                // Smooth parameters
-                CurrentLPFCoeff = LPFCoeffSmooth * CurrentLPFCoeff + (1.0f - LPFCoeffSmooth) * TargetLPFCoeff;
-                SmoothedGain = GainSmooth * SmoothedGain + (1.0f - GainSmooth) * TargetGain;
+                LastGainDb = GainDb;
+                Gain.SetTarget(FMath::Pow(10.0f, GainDb / 20.0f));
+            }
 
-                // Apply one-pole LPF: y[n] = (1-a)*x[n] + a*y[n-1]
-                float Input = InputData[i];
-                FilterState = (1.0f - CurrentLPFCoeff) * Input + CurrentLPFCoeff * FilterState;
+            LPFCoeff.Advance(NumSamples);
+            Gain.Advance(NumSamples);
 
-                // Apply gain
-                OutputData[i] = FilterState * SmoothedGain;
+            // Apply one-pole LPF: y[n] = (1-a)*x[n] + a*y[n-1]
+            if (LPFCoeff.IsSettled())
+            {
+                const float Coeff = LPFCoeff.GetValue();
+                const float InputCoeff = 1.0f - Coeff;
+                for (int32 i = 0; i < NumSamples; i++)
+                {
+                    FilterState = InputCoeff * InputData[i] + Coeff * FilterState;
+                    OutputData[i] = FilterState;
+                }
+            }
+            else
+            {
+                float Coeff = LPFCoeff.GetBlockStart();
+                const float CoeffStep = LPFCoeff.GetBlockStep();
+                for (int32 i = 0; i < NumSamples; i++)
+                {
+                    Coeff += CoeffStep;
+                    FilterState = (1.0f - Coeff) * InputData[i] + Coeff * FilterState;
+                    OutputData[i] = FilterState;
+                }
             }
+
+            // Apply gain
+            Gain.ApplyGain(OutputData, NumSamples);
         }
 
         void Reset(const IOperator::FResetParams& InParams)
         {
             FilterState = 0.0f;
-            SmoothedGain = 1.0f;
-            CurrentLPFCoeff = 0.0f;
+            LPFCoeff.SetValue(0.0f);
+            Gain.SetValue(1.0f);
+            LastLPFCutoff = -1.0f;
+            LastGainDb = 1.0f;
         }
 
     private:
@@ -191,10 +218,404 @@ namespace Metasound
 
         FAudioBufferWriteRef AudioOutput;
 
+        /** Time constants of the coefficient and gain ramps */
+        static constexpr float LPFSmoothingSeconds = 0.02f;
+        static constexpr float GainSmoothingSeconds = 0.04f;
+
         float SampleRate;
-        float CurrentLPFCoeff;
+        FAcousticSmoothedValue LPFCoeff;
+        FAcousticSmoothedValue Gain;
         float FilterState;
-        float SmoothedGain;
+
+        /** Inputs the targets were computed from */
+        float LastLPFCutoff;
+        float LastGainDb;
+    };
+
+    // ========================================================================
+    // ACOUSTIC EARLY REFLECTIONS OPERATOR
+    // ========================================================================
+
+    namespace AcousticMetaSoundPrivate
+    {
+        /** "Tap 0 Delay" .. "Tap 7 Delay" style vertex names */
+        TArray<FVertexName> MakeTapVertexNames(int32 NumTaps, const TCHAR* Suffix)
+        {
+            TArray<FVertexName> Names;
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                Names.Add(FVertexName(*FString::Printf(TEXT("Tap %d %s"), Tap, Suffix)));
+            }
+            return Names;
+        }
+    }
+
+    class FAcousticEarlyReflectionsOperator : public TExecutableOperator<FAcousticEarlyReflectionsOperator>
+    {
+    public:
+        static constexpr int32 NumTaps = 8;
+        static constexpr int32 MaxDelayMs = 500;
+
+        static const FVertexName& GetAudioInputName()
+        {
+            static FVertexName Name = TEXT("Audio");
+            return Name;
+        }
+
+        static const FVertexName& GetTapDelayInputName(int32 Tap)
+        {
+            static const TArray<FVertexName> Names = AcousticMetaSoundPrivate::MakeTapVertexNames(NumTaps, TEXT("Delay"));
+            return Names[Tap];
+        }
+
+        static const FVertexName& GetTapGainInputName(int32 Tap)
+        {
+            static const TArray<FVertexName> Names = AcousticMetaSoundPrivate::MakeTapVertexNames(NumTaps, TEXT("Gain"));
+            return Names[Tap];
+        }
+
+        static const FVertexName& GetTapLPFInputName(int32 Tap)
+        {
+            static const TArray<FVertexName> Names = AcousticMetaSoundPrivate::MakeTapVertexNames(NumTaps, TEXT("LPF"));
+            return Names[Tap];
+        }
+
+        static const FVertexName& GetWetDryInputName()
+        {
+            static FVertexName Name = TEXT("Wet/Dry");
+            return Name;
+        }
+
+        static const FVertexName& GetAudioOutputName()
+        {
+            static FVertexName Name = TEXT("Audio Out");
+            return Name;
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto InitNodeInfo = []() -> FNodeClassMetadata
+            {
+                FNodeClassMetadata Info;
+                Info.ClassName = { TEXT("UE"), TEXT("AcousticEarlyReflections"), TEXT("Audio") };
+                Info.MajorVersion = 1;
+                Info.MinorVersion = 0;
+                Info.DisplayName = LOCTEXT("AcousticEarlyReflectionsDisplayName", "Acoustic Early Reflections");
+                Info.Description = LOCTEXT("AcousticEarlyReflectionsDescription", "Eight filtered reflection taps driven by the acoustic engine's traced reflections");
+                Info.Author = TEXT("AcoustiTrace Pro");
+                Info.CategoryHierarchy = { LOCTEXT("AcousticCategory", "Acoustic") };
+                return Info;
+            };
+
+            static const FNodeClassMetadata Info = InitNodeInfo();
+            return Info;
+        }
+
+        static const FVertexInterface& GetVertexInterface()
+        {
+            auto InitInterface = []() -> FVertexInterface
+            {
+                FInputVertexInterface Inputs;
+                Inputs.Add(TInputDataVertex<FAudioBuffer>(GetAudioInputName(), FDataVertexMetadata{ LOCTEXT("ERAudioInputTT", "Input audio signal") }));
+                for (int32 Tap = 0; Tap < NumTaps; Tap++)
+                {
+                    Inputs.Add(TInputDataVertex<float>(GetTapDelayInputName(Tap), FDataVertexMetadata{ FText::Format(LOCTEXT("TapDelayInputTT", "Tap {0} delay (ms)"), Tap) }, 0.0f));
+                    Inputs.Add(TInputDataVertex<float>(GetTapGainInputName(Tap), FDataVertexMetadata{ FText::Format(LOCTEXT("TapGainInputTT", "Tap {0} gain (0-1)"), Tap) }, 0.0f));
+                    Inputs.Add(TInputDataVertex<float>(GetTapLPFInputName(Tap), FDataVertexMetadata{ FText::Format(LOCTEXT("TapLPFInputTT", "Tap {0} low-pass cutoff (Hz)"), Tap) }, 20000.0f));
+                }
+                Inputs.Add(TInputDataVertex<float>(GetWetDryInputName(), FDataVertexMetadata{ LOCTEXT("ERWetDryInputTT", "Reflection mix (0 = dry, 1 = reflections only)") }, 0.3f));
+
+                FOutputVertexInterface Outputs;
+                Outputs.Add(TOutputDataVertex<FAudioBuffer>(GetAudioOutputName(), FDataVertexMetadata{ LOCTEXT("ERAudioOutputTT", "Audio with early reflections") }));
+
+                return FVertexInterface(MoveTemp(Inputs), MoveTemp(Outputs));
+            };
+
+            static const FVertexInterface Interface = InitInterface();
+            return Interface;
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+        {
+            const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+            FAudioBufferReadRef AudioIn = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(
+                GetAudioInputName(), InParams.OperatorSettings);
+
+            TArray<FFloatReadRef> DelaysIn;
+            TArray<FFloatReadRef> GainsIn;
+            TArray<FFloatReadRef> LPFsIn;
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                DelaysIn.Add(InputData.GetOrCreateDefaultDataReadReference<float>(GetTapDelayInputName(Tap), InParams.OperatorSettings));
+                GainsIn.Add(InputData.GetOrCreateDefaultDataReadReference<float>(GetTapGainInputName(Tap), InParams.OperatorSettings));
+                LPFsIn.Add(InputData.GetOrCreateDefaultDataReadReference<float>(GetTapLPFInputName(Tap), InParams.OperatorSettings));
+            }
+
+            FFloatReadRef WetDryIn = InputData.GetOrCreateDefaultDataReadReference<float>(
+                GetWetDryInputName(), InParams.OperatorSettings);
+
+            return MakeUnique<FAcousticEarlyReflectionsOperator>(
+                InParams.OperatorSettings,
+                AudioIn,
+                DelaysIn,
+                GainsIn,
+                LPFsIn,
+                WetDryIn
+            );
+        }
+
+        FAcousticEarlyReflectionsOperator(
+            const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InAudio,
+            const TArray<FFloatReadRef>& InDelays,
+            const TArray<FFloatReadRef>& InGains,
+            const TArray<FFloatReadRef>& InLPFs,
+            const FFloatReadRef& InWetDry)
+            : AudioInput(InAudio)
+            , DelayInputs(InDelays)
+            , GainInputs(InGains)
+            , LPFInputs(InLPFs)
+            , WetDryInput(InWetDry)
+            , AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+            , SampleRate(InSettings.GetSampleRate())
+        {
+            // The whole block is written before any tap reads it, so the longest tap
+            // plus one block plus the interpolation sample must fit
+            MaxDelaySamples = MaxDelayMs * SampleRate / 1000.0f;
+            const int32 NumFramesPerBlock = InSettings.GetNumFramesPerBlock();
+            DelayLine.Init(FMath::CeilToInt(MaxDelaySamples) + NumFramesPerBlock + 2);
+
+            // Current and previous delay reads for every tap, sized up front
+            TapScratch.SetNumUninitialized(2 * NumTaps * NumFramesPerBlock);
+
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                TapGains[Tap].Init(SampleRate, ParamSmoothingSeconds);
+                TapLPFCoeffs[Tap].Init(SampleRate, ParamSmoothingSeconds);
+            }
+            WetDry.Init(SampleRate, ParamSmoothingSeconds);
+
+            ResetTaps();
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+        {
+            InOutVertexData.BindReadVertex(GetAudioInputName(), AudioInput);
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                InOutVertexData.BindReadVertex(GetTapDelayInputName(Tap), DelayInputs[Tap]);
+                InOutVertexData.BindReadVertex(GetTapGainInputName(Tap), GainInputs[Tap]);
+                InOutVertexData.BindReadVertex(GetTapLPFInputName(Tap), LPFInputs[Tap]);
+            }
+            InOutVertexData.BindReadVertex(GetWetDryInputName(), WetDryInput);
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+        {
+            InOutVertexData.BindReadVertex(GetAudioOutputName(), AudioOutput);
+        }
+
+        void Execute()
+        {
+            const float* InputData = AudioInput->GetData();
+            float* OutputData = AudioOutput->GetData();
+            const int32 NumSamples = AudioInput->Num();
+
+            if (NumSamples <= 0)
+            {
+                return;
+            }
+
+            // Write the block first so taps shorter than a block read this block's input
+            DelayLine.WriteBlock(InputData, NumSamples);
+
+            // Per-tap targets; the cutoff exp only runs when a cutoff moved
+            alignas(16) float PreviousDelays[NumTaps];
+            bool bDelayChanged = false;
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                const float DelaySamples = FMath::Clamp(*DelayInputs[Tap] * SampleRate / 1000.0f, 0.0f, MaxDelaySamples);
+
+                // A tap's first delay is taken as is; later changes crossfade
+                PreviousDelays[Tap] = TapDelays[Tap] < 0.0f ? DelaySamples : TapDelays[Tap];
+                bDelayChanged |= PreviousDelays[Tap] != DelaySamples;
+                TapDelays[Tap] = DelaySamples;
+
+                TapGains[Tap].SetTarget(FMath::Clamp(*GainInputs[Tap], 0.0f, 1.0f));
+
+                const float Cutoff = FMath::Clamp(*LPFInputs[Tap], 20.0f, 20000.0f);
+                if (Cutoff != LastLPFCutoffs[Tap])
+                {
+                    LastLPFCutoffs[Tap] = Cutoff;
+                    TapLPFCoeffs[Tap].SetTarget(FMath::Exp(-2.0f * PI * Cutoff / SampleRate));
+                }
+            }
+
+            WetDry.SetTarget(FMath::Clamp(*WetDryInput, 0.0f, 1.0f));
+
+            if (bDelayChanged)
+            {
+                ProcessTaps<true>(InputData, OutputData, NumSamples, PreviousDelays);
+            }
+            else
+            {
+                ProcessTaps<false>(InputData, OutputData, NumSamples, PreviousDelays);
+            }
+        }
+
+        void Reset(const IOperator::FResetParams& InParams)
+        {
+            DelayLine.Reset();
+            ResetTaps();
+        }
+
+    private:
+        /** Load one frame of every tap into two registers */
+        FORCEINLINE static void LoadTapFrame(const float* Rows, int32 NumSamples, int32 Frame, VectorRegister4Float& OutA, VectorRegister4Float& OutB)
+        {
+            alignas(16) float Lanes[NumTaps];
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                Lanes[Tap] = Rows[Tap * NumSamples + Frame];
+            }
+            OutA = VectorLoadAligned(Lanes);
+            OutB = VectorLoadAligned(Lanes + 4);
+        }
+
+        /** Read, filter, weight and sum all taps, then mix with the dry input */
+        template <bool bCrossfade>
+        void ProcessTaps(const float* InputData, float* OutputData, int32 NumSamples, const float* PreviousDelays)
+        {
+            // Block setup: one interpolated block read per tap and parameter ramps per lane
+            TapScratch.SetNumUninitialized(2 * NumTaps * NumSamples, EAllowShrinking::No);
+            float* Rows = TapScratch.GetData();
+            float* PreviousRows = Rows + NumTaps * NumSamples;
+
+            alignas(16) float Gains[NumTaps];
+            alignas(16) float GainSteps[NumTaps];
+            alignas(16) float Coeffs[NumTaps];
+            alignas(16) float CoeffSteps[NumTaps];
+
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                // The block's first frame was written NumSamples writes ago
+                DelayLine.ReadBlockFractional(NumSamples + TapDelays[Tap], Rows + Tap * NumSamples, NumSamples);
+                if (bCrossfade)
+                {
+                    DelayLine.ReadBlockFractional(NumSamples + PreviousDelays[Tap], PreviousRows + Tap * NumSamples, NumSamples);
+                }
+
+                TapGains[Tap].Advance(NumSamples);
+                Gains[Tap] = TapGains[Tap].GetBlockStart();
+                GainSteps[Tap] = TapGains[Tap].GetBlockStep();
+
+                TapLPFCoeffs[Tap].Advance(NumSamples);
+                Coeffs[Tap] = TapLPFCoeffs[Tap].GetBlockStart();
+                CoeffSteps[Tap] = TapLPFCoeffs[Tap].GetBlockStep();
+            }
+
+            WetDry.Advance(NumSamples);
+            float Mix = WetDry.GetBlockStart();
+            const float MixStep = WetDry.GetBlockStep();
+
+            VectorRegister4Float GainA = VectorLoadAligned(Gains);
+            VectorRegister4Float GainB = VectorLoadAligned(Gains + 4);
+            const VectorRegister4Float GainStepA = VectorLoadAligned(GainSteps);
+            const VectorRegister4Float GainStepB = VectorLoadAligned(GainSteps + 4);
+            VectorRegister4Float CoeffA = VectorLoadAligned(Coeffs);
+            VectorRegister4Float CoeffB = VectorLoadAligned(Coeffs + 4);
+            const VectorRegister4Float CoeffStepA = VectorLoadAligned(CoeffSteps);
+            const VectorRegister4Float CoeffStepB = VectorLoadAligned(CoeffSteps + 4);
+
+            // Old and new delay reads fade over this block
+            VectorRegister4Float Fade = VectorZeroFloat();
+            const VectorRegister4Float FadeStep = VectorSetFloat1(1.0f / NumSamples);
+
+            VectorRegister4Float StateA = VectorLoadAligned(TapFilterStates);
+            VectorRegister4Float StateB = VectorLoadAligned(TapFilterStates + 4);
+
+            alignas(16) float Sum[4];
+
+            for (int32 Frame = 0; Frame < NumSamples; Frame++)
+            {
+                VectorRegister4Float TapA, TapB;
+                LoadTapFrame(Rows, NumSamples, Frame, TapA, TapB);
+
+                if (bCrossfade)
+                {
+                    VectorRegister4Float PreviousA, PreviousB;
+                    LoadTapFrame(PreviousRows, NumSamples, Frame, PreviousA, PreviousB);
+
+                    Fade = VectorAdd(Fade, FadeStep);
+                    TapA = VectorMultiplyAdd(VectorSubtract(TapA, PreviousA), Fade, PreviousA);
+                    TapB = VectorMultiplyAdd(VectorSubtract(TapB, PreviousB), Fade, PreviousB);
+                }
+
+                // Per-tap one-pole LPF: y = (1 - a) * x + a * y
+                CoeffA = VectorAdd(CoeffA, CoeffStepA);
+                CoeffB = VectorAdd(CoeffB, CoeffStepB);
+                StateA = VectorMultiplyAdd(VectorSubtract(StateA, TapA), CoeffA, TapA);
+                StateB = VectorMultiplyAdd(VectorSubtract(StateB, TapB), CoeffB, TapB);
+
+                // Weighted sum across all eight lanes
+                GainA = VectorAdd(GainA, GainStepA);
+                GainB = VectorAdd(GainB, GainStepB);
+                VectorRegister4Float Wet = VectorMultiplyAdd(StateA, GainA, VectorMultiply(StateB, GainB));
+                Wet = VectorAdd(Wet, VectorSwizzle(Wet, 2, 3, 0, 1));
+                Wet = VectorAdd(Wet, VectorSwizzle(Wet, 1, 0, 3, 2));
+                VectorStoreAligned(Wet, Sum);
+
+                Mix += MixStep;
+                const float Dry = InputData[Frame];
+                OutputData[Frame] = Dry + (Sum[0] - Dry) * Mix;
+            }
+
+            VectorStoreAligned(StateA, TapFilterStates);
+            VectorStoreAligned(StateB, TapFilterStates + 4);
+        }
+
+        /** Clear filter state and snap the tap parameters back to silence */
+        void ResetTaps()
+        {
+            for (int32 Tap = 0; Tap < NumTaps; Tap++)
+            {
+                TapDelays[Tap] = -1.0f;
+                TapFilterStates[Tap] = 0.0f;
+                LastLPFCutoffs[Tap] = -1.0f;
+                TapGains[Tap].SetValue(0.0f);
+                TapLPFCoeffs[Tap].SetValue(0.0f);
+            }
+            WetDry.SetValue(0.0f);
+        }
+
+        FAudioBufferReadRef AudioInput;
+        TArray<FFloatReadRef> DelayInputs;
+        TArray<FFloatReadRef> GainInputs;
+        TArray<FFloatReadRef> LPFInputs;
+        FFloatReadRef WetDryInput;
+
+        FAudioBufferWriteRef AudioOutput;
+
+        /** Gain, cutoff and mix ramps; delays crossfade over one block instead */
+        static constexpr float ParamSmoothingSeconds = 0.02f;
+
+        float SampleRate;
+        float MaxDelaySamples;
+
+        /** Delay line shared by all taps */
+        FAcousticDelayLine DelayLine;
+
+        /** Per-tap block reads, one row of NumSamples per tap */
+        TArray<float> TapScratch;
+
+        /** Current read delay per tap in samples (negative = not set yet) */
+        alignas(16) float TapDelays[NumTaps];
+        alignas(16) float TapFilterStates[NumTaps];
+        float LastLPFCutoffs[NumTaps];
+        FAcousticSmoothedValue TapGains[NumTaps];
+        FAcousticSmoothedValue TapLPFCoeffs[NumTaps];
+        FAcousticSmoothedValue WetDry;
     };
 
     // ========================================================================
@@ -311,14 +732,16 @@ namespace Metasound
             , AudioOutputL(FAudioBufferWriteRef::CreateNew(InSettings))
             , AudioOutputR(FAudioBufferWriteRef::CreateNew(InSettings))
             , SampleRate(InSettings.GetSampleRate())
-            , DelayWriteIndex(0)
             , AllpassStateL(0.0f)
             , AllpassStateR(0.0f)
         {
             // Initialize decorrelation delay lines (~20ms max)
             int32 MaxDelaySamples = FMath::CeilToInt(SampleRate * 0.02f);
-            DecorrelationDelayL.SetNumZeroed(MaxDelaySamples);
-            DecorrelationDelayR.SetNumZeroed(MaxDelaySamples);
+            DecorrelationLineL.Init(MaxDelaySamples);
+            DecorrelationLineR.Init(MaxDelaySamples);
+
+            SmoothedWidth.Init(SampleRate, ParamSmoothingSeconds);
+            SmoothedAllpassCoeff.Init(SampleRate, ParamSmoothingSeconds);
         }
 
         virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
@@ -343,8 +766,16 @@ namespace Metasound
             float* OutputR = AudioOutputR->GetData();
             const int32 NumSamples = AudioInputL->Num();
 
-            const float Width = FMath::Clamp(*WidthInput, 0.0f, 1.0f);
-            const float Decorrelation = FMath::Clamp(*DecorrelationInput, 0.0f, 1.0f);
+            SmoothedWidth.SetTarget(FMath::Clamp(*WidthInput, 0.0f, 1.0f));
+            SmoothedAllpassCoeff.SetTarget(0.5f * FMath::Clamp(*DecorrelationInput, 0.0f, 1.0f));
+            SmoothedWidth.Advance(NumSamples);
+            SmoothedAllpassCoeff.Advance(NumSamples);
+
+            // Ramped across the block, constant once settled (the steps are then zero)
+            float Width = SmoothedWidth.GetBlockStart();
+            float AllpassCoeff = SmoothedAllpassCoeff.GetBlockStart();
+            const float WidthStep = SmoothedWidth.GetBlockStep();
+            const float AllpassCoeffStep = SmoothedAllpassCoeff.GetBlockStep();
 
             // Delay times for decorrelation
             int32 DelayL = FMath::RoundToInt(7.3f * SampleRate / 1000.0f); // 7.3ms
@@ -352,25 +783,22 @@ namespace Metasound
 
             for (int32 i = 0; i < NumSamples; i++)
             {
+                Width += WidthStep;
+                AllpassCoeff += AllpassCoeffStep;
+
                 float InL = InputL[i];
                 float InR = InputR[i];
 
                 // Create mono sum for narrow sounds
                 float Mono = (InL + InR) * 0.5f;
 
-                // Write to delay lines
-                DecorrelationDelayL[DelayWriteIndex] = InL;
-                DecorrelationDelayR[DelayWriteIndex] = InR;
-
-                // Read delayed and apply allpass for decorrelation
-                int32 ReadIndexL = (DelayWriteIndex - DelayL + DecorrelationDelayL.Num()) % DecorrelationDelayL.Num();
-                int32 ReadIndexR = (DelayWriteIndex - DelayR + DecorrelationDelayR.Num()) % DecorrelationDelayR.Num();
-
-                float DelayedL = DecorrelationDelayL[ReadIndexL];
-                float DelayedR = DecorrelationDelayR[ReadIndexR];
+                // Read delayed and apply allpass for decorrelation, then write the new samples
+                float DelayedL = DecorrelationLineL.Read(DelayL);
+                float DelayedR = DecorrelationLineR.Read(DelayR);
+                DecorrelationLineL.Write(InL);
+                DecorrelationLineR.Write(InR);
 
                 // Simple allpass for phase dispersion
-                float AllpassCoeff = 0.5f * Decorrelation;
                 float AllpassOutL = -InL * AllpassCoeff + AllpassStateL + DelayedL * AllpassCoeff;
                 float AllpassOutR = -InR * AllpassCoeff + AllpassStateR + DelayedR * AllpassCoeff;
                 AllpassStateL = InL + AllpassOutL * AllpassCoeff;
@@ -383,18 +811,17 @@ namespace Metasound
                 // Blend between mono (narrow) and decorrelated (wide) based on Width
                 OutputL[i] = FMath::Lerp(Mono, WideL, Width);
                 OutputR[i] = FMath::Lerp(Mono, WideR, Width);
-
-                DelayWriteIndex = (DelayWriteIndex + 1) % DecorrelationDelayL.Num();
             }
         }
 
         void Reset(const IOperator::FResetParams& InParams)
         {
-            FMemory::Memzero(DecorrelationDelayL.GetData(), DecorrelationDelayL.Num() * sizeof(float));
-            FMemory::Memzero(DecorrelationDelayR.GetData(), DecorrelationDelayR.Num() * sizeof(float));
-            DelayWriteIndex = 0;
+            DecorrelationLineL.Reset();
+            DecorrelationLineR.Reset();
             AllpassStateL = 0.0f;
             AllpassStateR = 0.0f;
+            SmoothedWidth.SetValue(0.0f);
+            SmoothedAllpassCoeff.SetValue(0.0f);
         }
 
     private:
@@ -407,16 +834,335 @@ namespace Metasound
         FAudioBufferWriteRef AudioOutputR;
 
         float SampleRate;
-        TArray<float> DecorrelationDelayL;
-        TArray<float> DecorrelationDelayR;
-        int32 DelayWriteIndex;
+        FAcousticDelayLine DecorrelationLineL;
+        FAcousticDelayLine DecorrelationLineR;
+        float AllpassStateL;
+        float AllpassStateR;
+
+        /** Width and decorrelation ramp over this long instead of stepping each block */
+        static constexpr float ParamSmoothingSeconds = 0.02f;
+        FAcousticSmoothedValue SmoothedWidth;
+        FAcousticSmoothedValue SmoothedAllpassCoeff;
+    };
+
+    // ========================================================================
+    // ACOUSTIC PROCESSOR OPERATOR (ALL-IN-ONE)
+    // ========================================================================
+
+    class FAcousticProcessorOperator : public TExecutableOperator<FAcousticProcessorOperator>
+    {
+    public:
+        static const FVertexName& GetAudioInputName()
+        {
+            static FVertexName Name = TEXT("Audio");
+            return Name;
+        }
+
+        static const FVertexName& GetOcclusionInputName()
+        {
+            static FVertexName Name = TEXT("Occlusion");
+            return Name;
+        }
+
+        static const FVertexName& GetLPFCutoffInputName()
+        {
+            static FVertexName Name = TEXT("LPF Cutoff");
+            return Name;
+        }
+
+        static const FVertexName& GetReverbSendInputName()
+        {
+            static FVertexName Name = TEXT("Reverb Send");
+            return Name;
+        }
+
+        static const FVertexName& GetSpatialWidthInputName()
+        {
+            static FVertexName Name = TEXT("Spatial Width");
+            return Name;
+        }
+
+        static const FVertexName& GetWetDryInputName()
+        {
+            static FVertexName Name = TEXT("Wet/Dry");
+            return Name;
+        }
+
+        static const FVertexName& GetAudioLeftOutputName()
+        {
+            static FVertexName Name = TEXT("Audio Out L");
+            return Name;
+        }
+
+        static const FVertexName& GetAudioRightOutputName()
+        {
+            static FVertexName Name = TEXT("Audio Out R");
+            return Name;
+        }
+
+        static const FVertexName& GetReverbSendOutputName()
+        {
+            static FVertexName Name = TEXT("Reverb Send Out");
+            return Name;
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto InitNodeInfo = []() -> FNodeClassMetadata
+            {
+                FNodeClassMetadata Info;
+                Info.ClassName = { TEXT("UE"), TEXT("AcousticProcessor"), TEXT("Audio") };
+                Info.MajorVersion = 1;
+                Info.MinorVersion = 0;
+                Info.DisplayName = LOCTEXT("AcousticProcessorDisplayName", "Acoustic Processor");
+                Info.Description = LOCTEXT("AcousticProcessorDescription", "Occlusion filtering, spatial width and reverb send in a single pass");
+                Info.Author = TEXT("AcoustiTrace Pro");
+                Info.CategoryHierarchy = { LOCTEXT("AcousticCategory", "Acoustic") };
+                return Info;
+            };
+
+            static const FNodeClassMetadata Info = InitNodeInfo();
+            return Info;
+        }
+
+        static const FVertexInterface& GetVertexInterface()
+        {
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(GetAudioInputName(), FDataVertexMetadata{ LOCTEXT("ProcAudioInTT", "Input mono audio") }),
+                    TInputDataVertex<float>(GetOcclusionInputName(), FDataVertexMetadata{ LOCTEXT("ProcOcclusionInTT", "Occlusion amount (0-1)") }, 0.0f),
+                    TInputDataVertex<float>(GetLPFCutoffInputName(), FDataVertexMetadata{ LOCTEXT("ProcLPFCutoffInTT", "Low-pass filter cutoff frequency (Hz)") }, 20000.0f),
+                    TInputDataVertex<float>(GetReverbSendInputName(), FDataVertexMetadata{ LOCTEXT("ProcReverbSendInTT", "Reverb send level (0-1)") }, 0.0f),
+                    TInputDataVertex<float>(GetSpatialWidthInputName(), FDataVertexMetadata{ LOCTEXT("ProcWidthInTT", "Spatial width (0=point, 1=diffuse)") }, 0.0f),
+                    TInputDataVertex<float>(GetWetDryInputName(), FDataVertexMetadata{ LOCTEXT("ProcWetDryInTT", "Processed mix (0 = unprocessed input)") }, 1.0f)
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(GetAudioLeftOutputName(), FDataVertexMetadata{ LOCTEXT("ProcAudioLOutTT", "Left output") }),
+                    TOutputDataVertex<FAudioBuffer>(GetAudioRightOutputName(), FDataVertexMetadata{ LOCTEXT("ProcAudioROutTT", "Right output") }),
+                    TOutputDataVertex<float>(GetReverbSendOutputName(), FDataVertexMetadata{ LOCTEXT("ProcReverbSendOutTT", "Reverb send amount") })
+                )
+            );
+            return Interface;
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutResults)
+        {
+            const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+            FAudioBufferReadRef AudioIn = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(
+                GetAudioInputName(), InParams.OperatorSettings);
+            FFloatReadRef OcclusionIn = InputData.GetOrCreateDefaultDataReadReference<float>(
+                GetOcclusionInputName(), InParams.OperatorSettings);
+            FFloatReadRef LPFCutoffIn = InputData.GetOrCreateDefaultDataReadReference<float>(
+                GetLPFCutoffInputName(), InParams.OperatorSettings);
+            FFloatReadRef ReverbSendIn = InputData.GetOrCreateDefaultDataReadReference<float>(
+                GetReverbSendInputName(), InParams.OperatorSettings);
+            FFloatReadRef SpatialWidthIn = InputData.GetOrCreateDefaultDataReadReference<float>(
+                GetSpatialWidthInputName(), InParams.OperatorSettings);
+            FFloatReadRef WetDryIn = InputData.GetOrCreateDefaultDataReadReference<float>(
+                GetWetDryInputName(), InParams.OperatorSettings);
+
+            return MakeUnique<FAcousticProcessorOperator>(
+                InParams.OperatorSettings,
+                AudioIn,
+                OcclusionIn,
+                LPFCutoffIn,
+                ReverbSendIn,
+                SpatialWidthIn,
+                WetDryIn
+            );
+        }
+
+        FAcousticProcessorOperator(
+            const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InAudio,
+            const FFloatReadRef& InOcclusion,
+            const FFloatReadRef& InLPFCutoff,
+            const FFloatReadRef& InReverbSend,
+            const FFloatReadRef& InSpatialWidth,
+            const FFloatReadRef& InWetDry)
+            : AudioInput(InAudio)
+            , OcclusionInput(InOcclusion)
+            , LPFCutoffInput(InLPFCutoff)
+            , ReverbSendInput(InReverbSend)
+            , SpatialWidthInput(InSpatialWidth)
+            , WetDryInput(InWetDry)
+            , AudioOutputL(FAudioBufferWriteRef::CreateNew(InSettings))
+            , AudioOutputR(FAudioBufferWriteRef::CreateNew(InSettings))
+            , ReverbSendOutput(FFloatWriteRef::CreateNew(0.0f))
+            , SampleRate(InSettings.GetSampleRate())
+            , LPFState(0.0f)
+            , LastLPFCutoff(-1.0f)
+            , LastOcclusion(-1.0f)
+            , AllpassStateL(0.0f)
+            , AllpassStateR(0.0f)
+        {
+            // Both channels decorrelate the same mono signal, so one line with two read offsets
+            DecorrelationDelayL = FMath::Max(FMath::RoundToInt(7.3f * SampleRate / 1000.0f), 1); // 7.3ms
+            DecorrelationDelayR = FMath::Max(FMath::RoundToInt(11.7f * SampleRate / 1000.0f), 1); // 11.7ms
+            DecorrelationLine.Init(DecorrelationDelayR);
+
+            LPFCoeff.Init(SampleRate, LPFSmoothingSeconds, EAcousticRampType::Exponential);
+            OcclusionGain.Init(SampleRate, GainSmoothingSeconds, EAcousticRampType::Exponential);
+            Width.Init(SampleRate, MixSmoothingSeconds);
+            WetDry.Init(SampleRate, MixSmoothingSeconds);
+            ResetSmoothing();
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+        {
+            InOutVertexData.BindReadVertex(GetAudioInputName(), AudioInput);
+            InOutVertexData.BindReadVertex(GetOcclusionInputName(), OcclusionInput);
+            InOutVertexData.BindReadVertex(GetLPFCutoffInputName(), LPFCutoffInput);
+            InOutVertexData.BindReadVertex(GetReverbSendInputName(), ReverbSendInput);
+            InOutVertexData.BindReadVertex(GetSpatialWidthInputName(), SpatialWidthInput);
+            InOutVertexData.BindReadVertex(GetWetDryInputName(), WetDryInput);
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+        {
+            InOutVertexData.BindReadVertex(GetAudioLeftOutputName(), AudioOutputL);
+            InOutVertexData.BindReadVertex(GetAudioRightOutputName(), AudioOutputR);
+            InOutVertexData.BindReadVertex(GetReverbSendOutputName(), ReverbSendOutput);
+        }
+
+        void Execute()
+        {
+            const float* InputData = AudioInput->GetData();
+            float* OutputL = AudioOutputL->GetData();
+            float* OutputR = AudioOutputR->GetData();
+            const int32 NumSamples = AudioInput->Num();
+
+            // Block-rate parameters; transcendentals only when an input changed
+            const float LPFCutoff = FMath::Clamp(*LPFCutoffInput, 20.0f, 20000.0f);
+            if (LPFCutoff != LastLPFCutoff)
+            {
+                LastLPFCutoff = LPFCutoff;
+                LPFCoeff.SetTarget(FMath::Exp(-2.0f * PI * LPFCutoff / SampleRate));
+            }
+
+            const float Occlusion = FMath::Clamp(*OcclusionInput, 0.0f, 1.0f);
+            if (Occlusion != LastOcclusion)
+            {
+                LastOcclusion = Occlusion;
+                OcclusionGain.SetTarget(FMath::Pow(10.0f, -Occlusion)); // Up to -20dB, as the occlusion filter node
+            }
+
+            Width.SetTarget(FMath::Clamp(*SpatialWidthInput, 0.0f, 1.0f));
+            WetDry.SetTarget(FMath::Clamp(*WetDryInput, 0.0f, 1.0f));
+
+            LPFCoeff.Advance(NumSamples);
+            OcclusionGain.Advance(NumSamples);
+            Width.Advance(NumSamples);
+            WetDry.Advance(NumSamples);
+
+            // Send follows the processed mix; it is a control value, one write per block
+            *ReverbSendOutput = FMath::Clamp(*ReverbSendInput, 0.0f, 1.0f) * WetDry.GetValue();
+
+            float Coeff = LPFCoeff.GetBlockStart();
+            float Gain = OcclusionGain.GetBlockStart();
+            float CurrentWidth = Width.GetBlockStart();
+            float Mix = WetDry.GetBlockStart();
+            const float CoeffStep = LPFCoeff.GetBlockStep();
+            const float GainStep = OcclusionGain.GetBlockStep();
+            const float WidthStep = Width.GetBlockStep();
+            const float MixStep = WetDry.GetBlockStep();
+
+            // One pass: LPF, gain, decorrelation and mix, written straight to both outputs
+            for (int32 i = 0; i < NumSamples; i++)
+            {
+                Coeff += CoeffStep;
+                Gain += GainStep;
+                CurrentWidth += WidthStep;
+                Mix += MixStep;
+
+                // Occlusion: one-pole LPF then gain
+                const float Dry = InputData[i];
+                LPFState = (1.0f - Coeff) * Dry + Coeff * LPFState;
+                const float Direct = LPFState * Gain;
+
+                // Decorrelation: delayed allpass per channel
+                const float DelayedL = DecorrelationLine.Read(DecorrelationDelayL);
+                const float DelayedR = DecorrelationLine.Read(DecorrelationDelayR);
+                DecorrelationLine.Write(Direct);
+
+                const float AllpassOutL = (DelayedL - Direct) * DecorrelationCoeff + AllpassStateL;
+                const float AllpassOutR = (DelayedR - Direct) * DecorrelationCoeff + AllpassStateR;
+                AllpassStateL = Direct + AllpassOutL * DecorrelationCoeff;
+                AllpassStateR = Direct + AllpassOutR * DecorrelationCoeff;
+
+                // Width blends point source to diffuse, Wet/Dry blends against the unprocessed input
+                const float WetL = Direct + (AllpassOutL - Direct) * CurrentWidth;
+                const float WetR = Direct + (AllpassOutR - Direct) * CurrentWidth;
+                OutputL[i] = Dry + (WetL - Dry) * Mix;
+                OutputR[i] = Dry + (WetR - Dry) * Mix;
+            }
+        }
+
+        void Reset(const IOperator::FResetParams& InParams)
+        {
+            DecorrelationLine.Reset();
+            AllpassStateL = 0.0f;
+            AllpassStateR = 0.0f;
+            LPFState = 0.0f;
+            ResetSmoothing();
+        }
+
+    private:
+        void ResetSmoothing()
+        {
+            LPFCoeff.SetValue(0.0f);
+            OcclusionGain.SetValue(1.0f);
+            Width.SetValue(0.0f);
+            WetDry.SetValue(1.0f);
+            LastLPFCutoff = -1.0f;
+            LastOcclusion = -1.0f;
+        }
+
+        FAudioBufferReadRef AudioInput;
+        FFloatReadRef OcclusionInput;
+        FFloatReadRef LPFCutoffInput;
+        FFloatReadRef ReverbSendInput;
+        FFloatReadRef SpatialWidthInput;
+        FFloatReadRef WetDryInput;
+
+        FAudioBufferWriteRef AudioOutputL;
+        FAudioBufferWriteRef AudioOutputR;
+        FFloatWriteRef ReverbSendOutput;
+
+        /** Same ramp times as the standalone occlusion filter and spatial width nodes */
+        static constexpr float LPFSmoothingSeconds = 0.02f;
+        static constexpr float GainSmoothingSeconds = 0.04f;
+        static constexpr float MixSmoothingSeconds = 0.02f;
+
+        /** Allpass coefficient of the spatial width node at its default decorrelation */
+        static constexpr float DecorrelationCoeff = 0.25f;
+
+        float SampleRate;
+
+        // Occlusion filter state
+        FAcousticSmoothedValue LPFCoeff;
+        FAcousticSmoothedValue OcclusionGain;
+        float LPFState;
+        float LastLPFCutoff;
+        float LastOcclusion;
+
+        // Spatial width state
+        FAcousticDelayLine DecorrelationLine;
+        int32 DecorrelationDelayL;
+        int32 DecorrelationDelayR;
         float AllpassStateL;
         float AllpassStateR;
+        FAcousticSmoothedValue Width;
+
+        FAcousticSmoothedValue WetDry;
     };
 
     // Register nodes
     METASOUND_REGISTER_NODE(FAcousticOcclusionFilterOperator);
+    METASOUND_REGISTER_NODE(FAcousticEarlyReflectionsOperator);
     METASOUND_REGISTER_NODE(FAcousticSpatialWidthOperator);
+    METASOUND_REGISTER_NODE(FAcousticProcessorOperator);
 
 } // namespace Metasound
 
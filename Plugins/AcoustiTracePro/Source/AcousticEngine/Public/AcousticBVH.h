@@ -0,0 +1,142 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Nearest hit of one ray against an FAcousticBVH
+ */
+struct FAcousticBVHHit
+{
+    /** Distance along the ray, in units of the ray direction's length */
+    float Distance = 0.0f;
+
+    /** Triangle index in build order, or INDEX_NONE */
+    int32 Triangle = INDEX_NONE;
+
+    bool IsValid() const { return Triangle != INDEX_NONE; }
+};
+
+/**
+ * Four rays traced together
+ *
+ * Lanes beyond NumRays are padded and never hit. Distances are measured in
+ * units of each direction's length, so rays moved into an instance's local
+ * space keep their world-space distances.
+ */
+struct FAcousticRayPacket
+{
+    static constexpr int32 Width = 4;
+
+    FVector3f Origins[Width];
+    FVector3f Directions[Width];
+    float MaxDistances[Width] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    int32 NumRays = 0;
+};
+
+/**
+ * Acoustic BVH
+ *
+ * Compact binary BVH over triangles, built with binned SAH. Nodes are 32
+ * bytes (bounds plus child/triangle offsets) and leaves store triangles in
+ * traversal order as a vertex and two edges, ready for Moller-Trumbore.
+ * Single rays use a nearest-child-first stack walk; ray packets test each
+ * node and triangle against four rays at once with VectorRegister4Float,
+ * which maps to SSE on x64 and NEON on ARM.
+ *
+ * The same tree also indexes arbitrary boxes (BuildFromBounds), which is
+ * how the geometry scene builds its top level over mesh instances. Such a
+ * tree is walked with Traverse/TraversePacket and refit in place when its
+ * boxes move.
+ *
+ * Immutable between builds and refits - safe to query from any number of threads.
+ */
+class ACOUSTICENGINE_API FAcousticBVH
+{
+public:
+    /** Build over triangles given as three consecutive positions each */
+    void Build(TConstArrayView<FVector3f> TriangleVertices);
+
+    /** Build over primitive boxes only (no triangles - query with Traverse/TraversePacket) */
+    void BuildFromBounds(TConstArrayView<FBox3f> PrimitiveBounds);
+
+    /** Refit node bounds to moved primitive boxes, keeping the topology */
+    void Refit(TConstArrayView<FBox3f> PrimitiveBounds);
+
+    /** Drop all geometry */
+    void Reset();
+
+    /** Nearest hit along a ray */
+    FAcousticBVHHit Intersect(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance) const;
+
+    /** Nearest hit for each ray of a packet */
+    void IntersectPacket(const FAcousticRayPacket& Packet, FAcousticBVHHit OutHits[FAcousticRayPacket::Width]) const;
+
+    /** Visit the primitives of every leaf a ray enters, nearest first. Visit returns the new max distance */
+    void Traverse(const FVector3f& Origin, const FVector3f& Direction, float MaxDistance,
+        TFunctionRef<float(int32 Primitive, float MaxDistance)> Visit) const;
+
+    /** Visit the primitives of every leaf any lane enters. Visit gets the entering lanes and may shorten MaxDistances */
+    void TraversePacket(const FAcousticRayPacket& Packet,
+        TFunctionRef<void(int32 Primitive, int32 LaneMask, float MaxDistances[FAcousticRayPacket::Width])> Visit) const;
+
+    /** Sum of node surface areas - grows as refits loosen the tree */
+    float GetTreeCost() const;
+
+    /** Bounds of all geometry */
+    FBox3f GetBounds() const { return Nodes.Num() > 0 ? FBox3f(Nodes[0].BoundsMin, Nodes[0].BoundsMax) : FBox3f(ForceInit); }
+
+    int32 GetNumTriangles() const { return Triangles.Num(); }
+    int32 GetNumPrimitives() const { return PrimitiveIds.Num(); }
+    int32 GetNumNodes() const { return Nodes.Num(); }
+    bool IsEmpty() const { return PrimitiveIds.Num() == 0; }
+
+    /** Primitives per leaf before a split is considered */
+    static constexpr int32 MaxLeafTriangles = 4;
+
+    /** SAH bins per axis */
+    static constexpr int32 NumBins = 12;
+
+private:
+    struct FNode
+    {
+        FVector3f BoundsMin;
+
+        /** Interior: index of the left child (right = left + 1). Leaf: first primitive */
+        int32 LeftOrFirst = 0;
+
+        FVector3f BoundsMax;
+
+        /** Primitives in a leaf, 0 for interior nodes */
+        int32 Count = 0;
+
+        bool IsLeaf() const { return Count > 0; }
+    };
+    static_assert(sizeof(FNode) == 32, "BVH nodes should stay 32 bytes");
+
+    struct FTriangle
+    {
+        FVector3f V0;
+        FVector3f Edge1;
+        FVector3f Edge2;
+    };
+
+    /** Build nodes and PrimitiveIds over primitive boxes */
+    void BuildTree(TArray<FBox3f>& PrimitiveBounds, TArray<FVector3f>& Centroids);
+
+    /** Split a node's primitive range, returns false if it should stay a leaf */
+    bool SplitNode(int32 NodeIndex, TArray<FVector3f>& Centroids, TArray<FBox3f>& PrimitiveBounds);
+
+    /** Recompute a node's bounds from its primitive range */
+    void UpdateNodeBounds(int32 NodeIndex, const TArray<FBox3f>& PrimitiveBounds);
+
+    /** Nodes, root first; children always follow their parent */
+    TArray<FNode> Nodes;
+
+    /** Triangles in leaf order (empty for box trees) */
+    TArray<FTriangle> Triangles;
+
+    /** Build-order primitive index per leaf-order primitive */
+    TArray<int32> PrimitiveIds;
+};
@@ -0,0 +1,286 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+#include "Serialization/BulkData.h"
+#include "AcousticTypes.h"
+#include "AcousticBakedData.generated.h"
+
+/**
+ * One baked reflection seen from a probe
+ */
+USTRUCT()
+struct FAcousticBakedTap
+{
+    GENERATED_BODY()
+
+    /** Probe-to-reflector distance (cm) */
+    UPROPERTY()
+    float Distance = 0.0f;
+
+    /** World-space direction from the probe to the reflector */
+    UPROPERTY()
+    FVector3f Direction = FVector3f::ZeroVector;
+
+    /** Surface type of the reflector */
+    UPROPERTY()
+    uint8 SurfaceType = 0;
+};
+
+/**
+ * Room response baked at a cell center
+ *
+ * Material-independent: the surfaces the probe saw are stored as a small
+ * weighted histogram, and decay times are derived from the live material
+ * table when the probe is sampled.
+ */
+USTRUCT()
+struct FAcousticBakedProbe
+{
+    GENERATED_BODY()
+
+    /** Number of surface slots in the histogram */
+    static constexpr int32 MaxSurfaces = 4;
+
+    /** Valid entries in the probe's tap slice */
+    UPROPERTY()
+    uint8 NumTaps = 0;
+
+    /** Average distance to the first hit of rays that hit something (cm) */
+    UPROPERTY()
+    float MeanFreePath = 0.0f;
+
+    /** Fraction of rays that escaped without a hit */
+    UPROPERTY()
+    float OpenFraction = 1.0f;
+
+    /** Most-hit surface types */
+    UPROPERTY()
+    uint8 SurfaceTypes[MaxSurfaces] = { 0, 0, 0, 0 };
+
+    /** Share of hits per surface slot, 0-255 */
+    UPROPERTY()
+    uint8 SurfaceWeights[MaxSurfaces] = { 0, 0, 0, 0 };
+};
+
+/**
+ * Baked Acoustic Data
+ *
+ * Offline-baked acoustic answers for the static geometry inside an
+ * AAcousticBakeVolume. The playable space is voxelized into a uniform grid;
+ * for every pair of open cells within MaxBakeDistance a static-only trace is
+ * run between the cell centers. Only occluded pairs are stored, as a sorted
+ * per-cell list (CSR), so a lookup is two cell computations and a binary
+ * search. Each entry packs the target cell with the surface type of the
+ * blocking hit; occlusion, transmission and LPF are derived from the
+ * material table at runtime, so tuning materials needs no rebake.
+ *
+ * The entry table is bulk data, memory-mapped on platforms that support it.
+ *
+ * Open cells also carry a reflection probe traced from the cell center: the
+ * earliest reflectors and a summary of the surrounding room, interpolated
+ * trilinearly between neighbouring cell centers at runtime.
+ */
+UCLASS(BlueprintType)
+class ACOUSTICENGINE_API UAcousticBakedData : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Bumped whenever the serialized layout changes; older data is ignored */
+    static constexpr int32 CurrentVersion = 2;
+
+    /** Cell is open (not embedded in static geometry) */
+    static constexpr uint8 CellFlag_Open = 1 << 0;
+
+    /** Cell has a baked reflection probe */
+    static constexpr uint8 CellFlag_Probe = 1 << 1;
+
+    /** Taps stored per probe */
+    static constexpr int32 MaxProbeTaps = FEarlyReflectionParams::MaxTaps;
+
+    /** Cell index bits in a packed occlusion entry */
+    static constexpr int32 EntryCellShift = 8;
+
+    /** Maximum cells a grid may hold (cell index must fit in an entry) */
+    static constexpr int32 MaxCells = 1 << (32 - EntryCellShift);
+
+    // ========================================================================
+    // UOBJECT
+    // ========================================================================
+
+    virtual void Serialize(FArchive& Ar) override;
+    virtual void PostLoad() override;
+    virtual void BeginDestroy() override;
+
+    // ========================================================================
+    // QUERIES
+    // ========================================================================
+
+    /** Is the data present, of the current version, and its occlusion entries mapped in full */
+    bool IsValid() const
+    {
+        return Version == CurrentVersion &&
+            CellFlags.Num() == GetNumCells() &&
+            OcclusionOffsets.Num() == GetNumCells() + 1 &&
+            NumOcclusionEntries == static_cast<int32>(OcclusionOffsets.Last());
+    }
+
+    /** Number of grid cells */
+    int32 GetNumCells() const { return GridDims.X * GridDims.Y * GridDims.Z; }
+
+    /** Open cell containing a location, or INDEX_NONE */
+    int32 FindOpenCell(const FVector& Location) const;
+
+    /** World-space center of a cell */
+    FVector GetCellCenter(int32 CellIndex) const;
+
+    /**
+     * Baked static occlusion between two locations.
+     * Returns false when either location is outside the bake or the pair is
+     * beyond MaxBakeDistance - the caller must trace instead.
+     */
+    bool LookupOcclusion(const FVector& From, const FVector& To, bool& bOutOccluded, uint8& OutSurfaceType) const;
+
+    /**
+     * Trilinear weights of the probes around a location.
+     * Missing probes are dropped and the rest renormalized. Returns the
+     * number of probes written (0 if the location is not covered).
+     */
+    int32 GatherProbeWeights(const FVector& Location, int32 OutCells[8], float OutWeights[8]) const;
+
+    /** Baked probe of a cell (check CellFlag_Probe first) */
+    const FAcousticBakedProbe& GetProbe(int32 CellIndex) const { return Probes[CellIndex]; }
+
+    /** Occluded targets of a cell, packed as stored */
+    TConstArrayView<uint32> GetOcclusionRow(int32 CellIndex) const
+    {
+        const int32 Begin = FMath::Min(static_cast<int32>(OcclusionOffsets[CellIndex]), NumOcclusionEntries);
+        const int32 End = FMath::Min(static_cast<int32>(OcclusionOffsets[CellIndex + 1]), NumOcclusionEntries);
+        return TConstArrayView<uint32>(OcclusionEntries + Begin, End - Begin);
+    }
+
+    /** Taps of a cell's probe, sorted by distance */
+    TConstArrayView<FAcousticBakedTap> GetProbeTaps(int32 CellIndex) const
+    {
+        return TConstArrayView<FAcousticBakedTap>(ProbeTaps.GetData() + CellIndex * MaxProbeTaps, Probes[CellIndex].NumTaps);
+    }
+
+    // ========================================================================
+    // BAKED DATA
+    // ========================================================================
+
+    /** Layout version the data was baked with */
+    UPROPERTY(VisibleAnywhere, Category = "Acoustic Bake")
+    int32 Version = 0;
+
+    /** Min corner of the grid */
+    UPROPERTY(VisibleAnywhere, Category = "Acoustic Bake")
+    FVector GridOrigin = FVector::ZeroVector;
+
+    /** Cell edge length in cm */
+    UPROPERTY(VisibleAnywhere, Category = "Acoustic Bake")
+    float CellSize = 800.0f;
+
+    /** Cells along each axis */
+    UPROPERTY(VisibleAnywhere, Category = "Acoustic Bake")
+    FIntVector GridDims = FIntVector::ZeroValue;
+
+    /** Cell pairs further apart than this were not baked (cm) */
+    UPROPERTY(VisibleAnywhere, Category = "Acoustic Bake")
+    float MaxBakeDistance = 5000.0f;
+
+    /** Per-cell flags (CellFlag_*) */
+    UPROPERTY()
+    TArray<uint8> CellFlags;
+
+    /** First occlusion entry per cell; NumCells + 1 entries */
+    UPROPERTY()
+    TArray<uint32> OcclusionOffsets;
+
+    /** Reflection probe per cell */
+    UPROPERTY()
+    TArray<FAcousticBakedProbe> Probes;
+
+    /** MaxProbeTaps taps per cell */
+    UPROPERTY()
+    TArray<FAcousticBakedTap> ProbeTaps;
+
+#if WITH_EDITORONLY_DATA
+    /** Hash of the static geometry overlapping each cell at bake time */
+    UPROPERTY()
+    TArray<uint32> CellHashes;
+
+    /** Hash of the grid and bake settings; a mismatch forces a full rebake */
+    UPROPERTY()
+    uint32 BakeSettingsHash = 0;
+#endif
+
+#if WITH_EDITOR
+    /** Replace the occlusion table (baker only) */
+    void SetOcclusionEntries(const TArray<uint32>& Entries);
+#endif
+
+private:
+    /** Grid coordinate for a location, false if outside the grid */
+    bool GetCellCoord(const FVector& Location, FIntVector& OutCoord) const;
+
+    /** Map the entry table for reading */
+    void MapOcclusionEntries();
+
+    /** Release the entry table mapping */
+    void UnmapOcclusionEntries();
+
+    /**
+     * Occluded pairs, one uint32 per entry: (TargetCell << EntryCellShift) | SurfaceType.
+     * Each cell lists only targets with a higher index, sorted ascending.
+     */
+    FByteBulkData OcclusionBulkData;
+
+    /** Mapped view of OcclusionBulkData */
+    const uint32* OcclusionEntries = nullptr;
+
+    /** Entries in the mapped view */
+    int32 NumOcclusionEntries = 0;
+};
+
+/**
+ * Acoustic Bake Volume
+ *
+ * Marks the playable space to bake acoustic data for and carries the baked
+ * asset. The asset is a hard reference, so it streams in and out with the
+ * level the volume is placed in.
+ */
+UCLASS(meta = (DisplayName = "Acoustic Bake Volume"))
+class ACOUSTICENGINE_API AAcousticBakeVolume : public AVolume
+{
+    GENERATED_BODY()
+
+public:
+    AAcousticBakeVolume();
+
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** Cell edge length used by the bake (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustic Bake", meta = (ClampMin = "100.0", ClampMax = "5000.0"))
+    float CellSize = 800.0f;
+
+    /** Cell pairs further apart than this are left to live traces (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustic Bake", meta = (ClampMin = "500.0", ClampMax = "30000.0"))
+    float MaxBakeDistance = 5000.0f;
+
+    /** Rays traced over the full sphere from each reflection probe */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustic Bake", meta = (ClampMin = "16", ClampMax = "1024"))
+    int32 ProbeRayCount = 128;
+
+    /** Radius of the probe sphere that decides whether a cell is embedded in geometry (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustic Bake", meta = (ClampMin = "1.0", ClampMax = "200.0"))
+    float OpenCellProbeRadius = 25.0f;
+
+    /** Baked data for this volume */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Acoustic Bake")
+    UAcousticBakedData* BakedData = nullptr;
+};
@@ -0,0 +1,62 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Acoustic Delay Line
+ *
+ * Mono ring buffer shared by the plugin's DSP. Capacity is a power of two,
+ * so positions wrap with a mask instead of an integer modulo. Delays count
+ * writes: Read(1) is the most recently written sample, Read(GetCapacity())
+ * the oldest one still held. Reading before writing a sample therefore
+ * gives a plain D-sample delay.
+ *
+ * Block reads and writes copy at most two contiguous spans (before and
+ * after the wrap). Fractional block reads interpolate linearly, four
+ * frames per SIMD register.
+ */
+class ACOUSTICENGINE_API FAcousticDelayLine
+{
+public:
+    /** Allocate at least MinCapacity samples, rounded up to a power of two, and clear them */
+    void Init(int32 MinCapacity);
+
+    /** Clear the buffer and rewind */
+    void Reset();
+
+    /** Samples held, and so the longest readable delay */
+    int32 GetCapacity() const { return Buffer.Num(); }
+
+    /** Append one sample */
+    FORCEINLINE void Write(float Sample)
+    {
+        Buffer[WriteIndex] = Sample;
+        WriteIndex = (WriteIndex + 1) & Mask;
+    }
+
+    /** Sample written DelaySamples writes ago (1 to GetCapacity()) */
+    FORCEINLINE float Read(int32 DelaySamples) const
+    {
+        return Buffer[(WriteIndex - static_cast<uint32>(DelaySamples)) & Mask];
+    }
+
+    /** Append a block */
+    void WriteBlock(const float* Input, int32 NumFrames);
+
+    /** Copy NumFrames consecutive samples, the first written DelaySamples writes ago */
+    void ReadBlock(int32 DelaySamples, float* Output, int32 NumFrames) const;
+
+    /** As ReadBlock, at a fractional delay with linear interpolation */
+    void ReadBlockFractional(float DelaySamples, float* Output, int32 NumFrames) const;
+
+private:
+    TArray<float> Buffer;
+
+    /** Capacity minus one */
+    uint32 Mask = 0;
+
+    /** Position the next sample is written to */
+    uint32 WriteIndex = 0;
+};
@@ -4,9 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAcousticEngine, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("AcoustiTrace"), STATGROUP_AcousticEngine, STATCAT_Advanced);
+
 /**
  * Acoustic Engine Module
  *
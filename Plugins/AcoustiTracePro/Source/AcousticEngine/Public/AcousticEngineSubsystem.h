@@ -4,7 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "HAL/CriticalSection.h"
+#include "Tasks/Task.h"
 #include "AcousticTypes.h"
+#include "AcousticSourceRegistry.h"
+#include "AcousticSourceGrid.h"
+#include "AcousticZoneIndex.h"
+#include "AcousticGeometryScene.h"
+#include "AcousticPortalGraph.h"
 #include "AcousticEngineSubsystem.generated.h"
 
 class UAcousticSourceComponent;
@@ -12,6 +20,10 @@ class AAcousticZoneVolume;
 class AAcousticPortalVolume;
 class UAcousticSettings;
 class UAcousticProfileAsset;
+class UPhysicalMaterial;
+class UAcousticBakedData;
+class ULevel;
+class AActor;
 
 /**
  * Ray budget allocation for a single frame
@@ -25,42 +37,244 @@ struct FRayBudgetAllocation
     int32 ReflectionRays = 0;
     int32 TotalRaysUsed = 0;
     int32 TotalRaysBudget = 0;
+
+    /** Due occlusion updates served from the motion-aware cache instead of a ray */
+    int32 OcclusionCacheHits = 0;
+
+    /** Due occlusion updates answered from baked data instead of a full trace */
+    int32 BakedOcclusionLookups = 0;
+
+    /** Reflection updates served from baked probes instead of the live probe */
+    int32 BakedReflectionUpdates = 0;
+
+    /** Sources skipped because no listener can reach their zone */
+    int32 ZoneCulledSources = 0;
+
+    /** Sources gathered within OffLODDistance of a listener and scored */
+    int32 GatheredSources = 0;
+
+    /** Sources assigned Advanced and Hero LOD this update */
+    int32 AdvancedSources = 0;
+    int32 HeroSources = 0;
+
+    /** Age of the oldest occlusion result per LOD, in seconds (indexed by EAcousticLOD) */
+    float WorstOcclusionStaleness[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+};
+
+/**
+ * One reflection point of a path traced out from the listener
+ *
+ * A probe ray's hit is the first vertex; each later bounce leaves the
+ * previous one in the mirror direction, blended toward a diffuse direction
+ * by the surface's scattering coefficient.
+ */
+struct FAcousticPathVertex
+{
+    FVector Location = FVector::ZeroVector;
+
+    /** Surface normal, facing the side the path arrived from */
+    FVector Normal = FVector::ZeroVector;
+
+    /** Listener to this vertex along the path (cm) */
+    float PathLength = 0.0f;
+
+    /** Band-averaged energy left after every reflection up to and including this one */
+    float Energy = 1.0f;
+
+    /** High-band energy left after every reflection up to and including this one */
+    float HighEnergy = 1.0f;
+
+    bool bIsValid = false;
+};
+
+/**
+ * Next bounce of a probe path, traced one bounce per frame in async trace mode
+ */
+struct FAcousticPendingPathTrace
+{
+    /** Async trace handle (invalid until the bounce is issued) */
+    FTraceHandle Handle;
+
+    /** Probe ray the path belongs to */
+    int32 RayIndex = 0;
+
+    /** Path generation the bounce extends; a re-traced ray drops it */
+    uint32 Generation = 0;
+
+    /** Path vertex the bounce fills */
+    int32 Bounce = 0;
+
+    /** Bounce ray */
+    FVector Start = FVector::ZeroVector;
+    FVector Direction = FVector::ZeroVector;
+};
+
+/**
+ * Planar reflector around a listener, fitted to the probe hits
+ */
+struct FAcousticReflectorPlane
+{
+    /** Plane with its normal facing the listener */
+    FPlane Plane = FPlane(ForceInit);
+
+    /** Probe hits the plane was fitted to */
+    int32 NumHits = 0;
 };
 
 /**
- * Registered acoustic source entry
+ * Shared reflection probe traced from a listener
+ *
+ * The hemisphere around a listener is the same for every source, so it is
+ * traced once per listener and each source derives its early reflection taps
+ * from the shared hit set. The hemisphere is refreshed as a rolling sweep: a
+ * slice of rays is re-traced every frame so a full sweep completes once per
+ * reflection interval without a burst of traces on a single frame.
+ *
+ * With more than one bounce, every re-traced ray also extends its hit into a
+ * path of later reflections. The paths are source-independent prefixes, so
+ * they are cached with the sweep and each source only checks whether the
+ * path's last vertex can see it.
+ *
+ * Each completed sweep also fits the dominant planes among its hits; Hero
+ * sources mirror themselves across them for exact specular image paths.
  */
 USTRUCT()
-struct FAcousticSourceEntry
+struct FAcousticReflectionProbe
 {
     GENERATED_BODY()
 
-    /** Weak pointer to the source component */
-    TWeakObjectPtr<UAcousticSourceComponent> SourceComponent;
+    /** Listener location the probe was traced from */
+    FVector Origin = FVector::ZeroVector;
+
+    /** Listener forward direction the hemisphere was oriented along */
+    FVector Forward = FVector::ForwardVector;
+
+    /** Valid hits from the probe rays */
+    TArray<FAcousticRayHit> Hits;
+
+    /** Number of rays in a full sweep */
+    int32 NumRays = 0;
+
+    /** Time the probe was last traced */
+    double LastUpdateTime = 0.0;
+
+    /** Has a full sweep completed since the ray count last changed */
+    bool bIsValid = false;
+
+    /** Hemisphere directions around +Z, rotated onto the listener forward per slice */
+    TArray<FVector> LocalDirections;
+
+    /** Latest result per ray direction */
+    TArray<FAcousticRayHit> RayHits;
+
+    /** Next ray to re-trace in the rolling sweep */
+    int32 NextRay = 0;
+
+    /** Fractional rays owed to the sweep */
+    float SliceCarry = 0.0f;
+
+    /** Async traces issued for the current slice (async trace mode) */
+    TArray<FTraceHandle> PendingTraces;
+
+    /** First ray index of the pending slice */
+    int32 PendingFirstRay = 0;
+
+    /** Vertices per path: the probe hit plus the bounces traced beyond it */
+    int32 NumBounces = 1;
 
-    /** Unique source ID */
-    int32 SourceId = -1;
+    /** Reflection paths, NumBounces consecutive vertices per ray */
+    TArray<FAcousticPathVertex> PathVertices;
 
-    /** Current computed parameters */
-    FAcousticSourceParams CurrentParams;
+    /** Generation each ray's path was last traced at; per-source visibility is keyed on it */
+    TArray<uint32> PathGenerations;
 
-    /** Previous frame parameters (for interpolation) */
-    FAcousticSourceParams PreviousParams;
+    /** Next path generation (never reset, so a regrown probe cannot alias old results) */
+    uint32 NextPathGeneration = 1;
 
-    /** Effective LOD after budget considerations */
-    EAcousticLOD EffectiveLOD = EAcousticLOD::Basic;
+    /** Paths whose next bounce is queued or in flight (async trace mode) */
+    TArray<FAcousticPendingPathTrace> PendingPathTraces;
 
-    /** Priority score for ray budget allocation */
-    float PriorityScore = 0.0f;
+    /** Dominant planes among the hits of the last completed sweep, most supported first */
+    TArray<FAcousticReflectorPlane> ReflectorPlanes;
 
-    /** Last occlusion update time */
-    double LastOcclusionUpdateTime = 0.0;
+    /** Bumped whenever the reflector planes change; image trees are keyed on it */
+    uint32 PlaneGeneration = 0;
 
-    /** Last reflection update time */
-    double LastReflectionUpdateTime = 0.0;
+    /** A sweep completed since the reflector planes were last fitted */
+    bool bPlanesDirty = false;
+};
+
+/**
+ * Baked reflection probes interpolated at a listener
+ *
+ * Taps are slot-wise blends of the surrounding probes' earliest reflectors,
+ * with materials already resolved; decay times are estimated per band from
+ * the probes' mean free path and surface mix.
+ */
+struct FAcousticBakedProbeSample
+{
+    struct FTap
+    {
+        /** World-space direction from the listener to the reflector */
+        FVector Direction = FVector::ZeroVector;
+
+        /** Listener-to-reflector distance (cm) */
+        float Distance = 0.0f;
+
+        /** Reflector absorption, averaged over bands */
+        float AverageAbsorption = 0.0f;
+
+        /** Reflector high-band absorption */
+        float HighAbsorption = 0.0f;
+    };
+
+    /** Blended taps, earliest first */
+    FTap Taps[FEarlyReflectionParams::MaxTaps];
+
+    /** Valid entries in Taps */
+    int32 NumTaps = 0;
+
+    /** Fraction of probe rays that found a reflector */
+    float ReflectionDensity = 0.0f;
+
+    /** Estimated reverb time (mid band) and band ratios */
+    float RT60 = 1.0f;
+    float HFDecay = 1.0f;
+    float LFDecay = 1.0f;
+
+    /** Does baked data cover the listener */
+    bool bIsValid = false;
+};
+
+/**
+ * Immutable input to one simulation update
+ *
+ * Published by the game thread before each update. The simulation reads
+ * listener and zone state only from here, never from the live arrays the
+ * game thread keeps writing while a worker update is in flight.
+ */
+struct FAcousticSimulationFrame
+{
+    /** Listener transforms */
+    TArray<FAcousticListenerData> Listeners;
+
+    /** Zone preset per listener */
+    TArray<FAcousticZonePreset> ZonePresets;
+
+    /** Baked reflection probes per listener */
+    TArray<FAcousticBakedProbeSample> ProbeSamples;
+
+    /** Portal graph node of each listener's zone */
+    TArray<int32> ListenerZoneNodes;
+
+    /** Potentially audible zones per listener, recomputed when its node or the portal topology changes */
+    TArray<FAcousticAudibleZoneSet> AudibleZoneSets;
 
-    /** Is this source currently audible */
-    bool bIsAudible = true;
+    /** Dense indices of the sources within OffLODDistance of a listener - the only ones scored */
+    TArray<int32> CandidateSources;
+
+    /** Dense indices of last frame's candidates that left every listener's range */
+    TArray<int32> ReleasedSources;
 };
 
 /**
@@ -110,6 +324,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Acoustic Engine")
     void ForceSourceUpdate(int32 SourceId);
 
+    /** Source transform changed - its position is re-read at the start of the next update */
+    void NotifySourceMoved(int32 SourceId);
+
+    /** Drop cached occlusion for every sound path passing within Radius of Center (call when dynamic geometry changes) */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic Engine")
+    void InvalidateOcclusionInRadius(const FVector& Center, float Radius);
+
     // ========================================================================
     // LISTENER MANAGEMENT
     // ========================================================================
@@ -141,6 +362,9 @@ public:
     /** Unregister a portal volume */
     void UnregisterPortal(AAcousticPortalVolume* Portal);
 
+    /** Portal opened or closed - cached occlusion and portal routes through it are no longer valid */
+    void NotifyPortalChanged(AAcousticPortalVolume* Portal);
+
     /** Get current zone for a location */
     UFUNCTION(BlueprintCallable, Category = "Acoustic Engine")
     AAcousticZoneVolume* GetZoneAtLocation(const FVector& Location) const;
@@ -149,6 +373,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Acoustic Engine")
     FAcousticZonePreset GetCurrentZonePreset(int32 ListenerIndex = 0) const;
 
+    // ========================================================================
+    // BAKED DATA
+    // ========================================================================
+
+    /** Make baked data available to occlusion lookups (called by bake volumes) */
+    void RegisterBakedData(UAcousticBakedData* BakedData);
+
+    /** Stop using baked data (called when its level streams out) */
+    void UnregisterBakedData(UAcousticBakedData* BakedData);
+
+    // ========================================================================
+    // GEOMETRY SCENE
+    // ========================================================================
+
+    /** Rebuild the acoustic BVH from the static geometry currently loaded */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic Engine")
+    void RebuildGeometryScene();
+
     // ========================================================================
     // AUDIO MODE
     // ========================================================================
@@ -173,6 +415,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Acoustic Engine")
     void RegisterMaterialMapping(FName PhysMatName, const FAcousticMaterial& AcousticMat);
 
+    /** Get the acoustic material a ray hit resolved to */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic Engine")
+    FAcousticMaterial GetHitMaterial(const FAcousticRayHit& Hit) const { return GetMaterialByIndex(Hit.MaterialIndex); }
+
+    /** Get a material from the compiled table */
+    const FAcousticMaterial& GetMaterialByIndex(uint8 MaterialIndex) const
+    {
+        return MaterialTable.IsValidIndex(MaterialIndex) ? MaterialTable[MaterialIndex] : DefaultMaterial;
+    }
+
+    /** Resolve a physical material to its slot in the compiled table */
+    uint8 ResolveMaterialIndex(const UPhysicalMaterial* PhysMat) const;
+
+    /** Compile material mappings into the surface-indexed table */
+    void BuildMaterialTable();
+
     // ========================================================================
     // RUNTIME QUERIES
     // ========================================================================
@@ -191,11 +449,11 @@ public:
 
     /** Get current frame ray budget usage */
     UFUNCTION(BlueprintCallable, Category = "Acoustic Engine|Debug")
-    FRayBudgetAllocation GetRayBudgetUsage() const { return CurrentBudget; }
+    FRayBudgetAllocation GetRayBudgetUsage() const { return PublishedBudget; }
 
     /** Get number of registered sources */
     UFUNCTION(BlueprintCallable, Category = "Acoustic Engine|Debug")
-    int32 GetNumRegisteredSources() const { return RegisteredSources.Num(); }
+    int32 GetNumRegisteredSources() const { return Sources.Num(); }
 
     /** Get number of active (audible) sources */
     UFUNCTION(BlueprintCallable, Category = "Acoustic Engine|Debug")
@@ -205,10 +463,14 @@ public:
     // EVENTS
     // ========================================================================
 
-    /** Broadcast when acoustic params update for any source */
+    /** Broadcast per source whose params changed (prefer the batched event) */
     UPROPERTY(BlueprintAssignable, Category = "Acoustic Engine|Events")
     FOnAcousticParamsUpdated OnAcousticParamsUpdated;
 
+    /** Broadcast once per update with every source whose params changed */
+    UPROPERTY(BlueprintAssignable, Category = "Acoustic Engine|Events")
+    FOnAcousticParamsBatchUpdated OnAcousticParamsBatchUpdated;
+
     /** Broadcast when listener changes zone */
     UPROPERTY(BlueprintAssignable, Category = "Acoustic Engine|Events")
     FOnAcousticZoneChanged OnAcousticZoneChanged;
@@ -218,26 +480,201 @@ protected:
     // INTERNAL PROCESSING
     // ========================================================================
 
-    /** Main update loop */
+    /** Main update loop (game thread) */
     void ProcessAcousticUpdate(float DeltaTime);
 
+    /** Consume the previous worker update and launch the next one */
+    void TickAsyncSimulation(float DeltaTime);
+
+    /** Game-thread work before a simulation update: zones, async trace results, snapshot */
+    void BeginAcousticUpdate(float DeltaTime);
+
+    /** Priorities, ray budget, occlusion and reflections. Safe to run on a worker */
+    void RunSimulation(float DeltaTime);
+
+    /** Game-thread work after a simulation update: stats and parameter delivery */
+    void FinishAcousticUpdate();
+
+    /** Copy listener, zone and source transforms into the simulation inputs */
+    void PublishSimulationFrame();
+
+    /** Re-read positions and zones of moved sources and keep the source grid current */
+    void RefreshMovedSources();
+
+    /** Collect the sources near any listener and snapshot their priority inputs */
+    void GatherCandidateSources();
+
+    /** Copy the results game-thread queries are served from while a worker update runs */
+    void PublishReadBuffer();
+
+    /** Block until the worker update (if any) completes */
+    void WaitForSimulation();
+
+    /** Is a worker update currently running */
+    bool IsSimulationInFlight() const { return SimulationTask.IsValid() && !SimulationTask.IsCompleted(); }
+
+    /** World traces resolve UObjects, so worker updates only run against the geometry scene */
+    bool CanRunSimulationOnWorker() const { return ShouldUseGeometryScene(); }
+
+    /** Async scene queries are game-thread only and unused while the geometry scene serves traces */
+    bool ShouldUseAsyncTraces() const { return Settings->bUseAsyncTraces && IsInGameThread() && !ShouldUseGeometryScene(); }
+
+    /** Is static geometry traced against the acoustic BVH */
+    bool ShouldUseGeometryScene() const { return Settings->bUseAcousticGeometryScene && !GeometryScene.IsEmpty(); }
+
+    /** A level streamed in or out - rebuild the geometry scene before the next update */
+    void OnLevelsChanged(ULevel* Level, UWorld* InWorld);
+
+    /** Queue a spawned actor's meshes for the geometry scene */
+    void OnActorSpawned(AActor* Actor);
+
+    /** Apply level changes, spawned actors and moved instances to the geometry scene */
+    void UpdateGeometryScene();
+
     /** Update priorities and allocate ray budget */
     void UpdateSourcePriorities();
 
     /** Process occlusion for sources */
     void ProcessOcclusion(float DeltaTime);
 
+    /** Per-source update interval for a base rate, scaled by LOD */
+    float GetUpdateInterval(float BaseRateHz, EAcousticLOD LOD) const;
+
+    /** Occlusion update interval for a LOD */
+    float GetOcclusionInterval(EAcousticLOD LOD) const;
+
+    /** Reflection probe size needed for the LODs currently in use */
+    int32 GetProbeRayCount() const;
+
+    /** Path vertices per probe ray needed for the LODs currently in use */
+    int32 GetProbeBounceCount() const;
+
+    /** Steady-state ray demand of all active sources, in rays per second */
+    float ComputeRayDemandPerSecond() const;
+
+    /** Can a due source reuse its cached occlusion instead of tracing */
+    bool IsOcclusionCacheValid(int32 DenseIndex, const FVector& ListenerLocation, double CurrentTime) const;
+
+    /** Apply occlusion invalidations queued since the last update */
+    void ApplyOcclusionInvalidations();
+
+    /** Scheduler credit earned per update by a waiting source of this LOD */
+    float GetSchedulerWeight(EAcousticLOD LOD) const;
+
+    /** Measure the oldest occlusion result per LOD */
+    void UpdateStalenessStats();
+
     /** Process reflections for sources */
     void ProcessReflections(float DeltaTime);
 
     /** Update zone detection for listeners */
     void UpdateListenerZones();
 
-    /** Apply computed params to audio components */
+    /** Resolve each listener's zone and preset once for this frame */
+    void RefreshListenerZoneCache();
+
+    /** Push params that changed beyond their thresholds to audio components */
     void ApplyParamsToSources();
 
-    /** Cluster reflection hits into taps */
-    void ClusterReflections(const TArray<FAcousticRayHit>& Hits, FEarlyReflectionParams& OutParams);
+    /** Does Current differ from the last pushed params by more than the configured thresholds */
+    bool HasSignificantParamChange(const FAcousticSourceParams& Applied, const FAcousticSourceParams& Current) const;
+
+    /** Consume async traces issued last frame */
+    void ConsumeAsyncTraces();
+
+    /** Issue an async occlusion trace for a source */
+    bool IssueAsyncOcclusionTrace(int32 DenseIndex, const FVector& Start, const FVector& End);
+
+    /** Baked static occlusion between listener and source; false if no baked data covers the pair */
+    bool LookupBakedOcclusion(const FVector& ListenerLocation, const FVector& SourceLocation, FAcousticRayHit& OutHit) const;
+
+    /** Table slot for a baked surface type */
+    uint8 GetSurfaceMaterialIndex(uint8 SurfaceType) const;
+
+    /** Interpolate baked reflection probes at a location; false if no bake covers it */
+    bool SampleBakedProbes(const FVector& Location, FAcousticBakedProbeSample& OutSample) const;
+
+    /** Trace against movable geometry only (the part baked data cannot answer) */
+    float TraceDynamicOcclusion(const FVector& Start, const FVector& End, FAcousticRayHit& OutHit) const;
+
+    /** Apply an occlusion result to a source */
+    void ApplyOcclusionResult(int32 DenseIndex, const FAcousticRayHit& Hit, float Occlusion, double CurrentTime);
+
+    /** Route an occluded source through open portals to the primary listener */
+    void UpdatePortalPath(int32 DenseIndex, float Occlusion);
+
+    /** Rebuild the portal graph or refresh changed portals */
+    void UpdatePortalGraph();
+
+    /** Can any listener reach a zone node through open portals */
+    bool IsZoneNodeAudible(int32 ZoneNode) const;
+
+    /** Hold a fully occluded result for a source whose zone was culled */
+    void ApplyZoneCulledResult(int32 DenseIndex, double CurrentTime);
+
+    /** Convert a physics hit into an acoustic hit */
+    void FillRayHit(const FHitResult& HitResult, FAcousticRayHit& OutHit) const;
+
+    /** Build the shared trace query params */
+    FCollisionQueryParams MakeTraceQueryParams(EQueryMobilityType MobilityType = EQueryMobilityType::Any) const;
+
+    /** Re-trace the next slice of the shared reflection probe for a listener */
+    const FAcousticReflectionProbe* UpdateReflectionProbe(int32 ListenerIndex, int32 NumRays, int32 NumBounces, float DeltaTime);
+
+    /** Drop everything a probe traced and restart its sweep */
+    void ResetReflectionProbe(FAcousticReflectionProbe& Probe) const;
+
+    /** Change a probe's ray and bounce counts, carrying hits and path prefixes over to the new layout */
+    void ResizeReflectionProbe(FAcousticReflectionProbe& Probe, int32 NumRays, int32 NumBounces) const;
+
+    /** Rebuild the paths of a range of probe rays from their hits, tracing the later bounces */
+    void TraceProbePaths(FAcousticReflectionProbe& Probe, int32 FirstRay, int32 NumPathRays);
+
+    /** Restart a ray's path from its probe hit. Returns true with the first bounce ray if the path continues */
+    bool BeginProbePath(FAcousticReflectionProbe& Probe, int32 RayIndex, FVector& OutStart, FVector& OutDirection) const;
+
+    /** Add a hit as a path vertex. Returns true with the next bounce ray if the path continues */
+    bool ExtendProbePath(FAcousticReflectionProbe& Probe, int32 RayIndex, int32 Bounce, const FAcousticRayHit& Hit,
+        FVector Incoming, FVector& OutStart, FVector& OutDirection) const;
+
+    /** Issue a probe's queued path bounces as async traces */
+    void IssueProbePathTraces(FAcousticReflectionProbe& Probe);
+
+    /** Rebuild a probe's compact hit list from its per-ray results */
+    void RebuildProbeHits(FAcousticReflectionProbe& Probe) const;
+
+    /** Cluster shared probe hits into taps for a source */
+    void ClusterReflections(const TArray<FAcousticRayHit>& Hits, const FAcousticListenerData& Listener,
+        const FVector& SourceLocation, FEarlyReflectionParams& OutParams);
+
+    /** Build a source's taps from the probe's cached paths, validating each path's last leg to the source */
+    void TraceReflectionPaths(const FAcousticReflectionProbe& Probe, const FAcousticListenerData& Listener,
+        const FVector& SourceLocation, TArray<FAcousticPathVisibility>& Visibility, FEarlyReflectionParams& OutParams);
+
+    /** Fit the dominant reflector planes to a probe's hits, keeping the old set if the room is unchanged */
+    void ExtractReflectorPlanes(FAcousticReflectionProbe& Probe) const;
+
+    /** Mirror a source across the probe's reflector planes up to MaxOrder reflections */
+    void BuildImageTree(const FAcousticReflectionProbe& Probe, const FVector& SourceLocation, int32 MaxOrder, FAcousticImageTree& OutTree) const;
+
+    /** Build a source's taps from its image sources, re-tracing the visibility of each path */
+    void TraceImageSources(const FAcousticReflectionProbe& Probe, const FAcousticListenerData& Listener,
+        const FVector& SourceLocation, FAcousticImageTree& Tree, FEarlyReflectionParams& OutParams);
+
+    /** Trace the legs of one image path; false if any leg misses its reflector or is blocked */
+    bool ValidateImagePath(const FAcousticReflectionProbe& Probe, const FAcousticImageTree& Tree, int32 ImageIndex,
+        const FVector& ListenerLocation, const FVector& SourceLocation, FVector& OutArrivalPoint, float& OutEnergy, float& OutHighEnergy);
+
+    /** Add taps from Extra that do not duplicate a tap already in InOut, keeping taps sorted by delay */
+    void MergeReflectionTaps(const FEarlyReflectionParams& Extra, FEarlyReflectionParams& InOut) const;
+
+    /** Derive a source's taps from a baked probe sample */
+    void BuildBakedReflections(const FAcousticBakedProbeSample& Sample, const FAcousticListenerData& Listener,
+        const FVector& SourceLocation, FEarlyReflectionParams& OutParams) const;
+
+    /** Fill one tap from a reflection path */
+    void FillReflectionTap(FReflectionTap& Tap, float PathLength, const FVector& ReflectorLocation,
+        float AverageAbsorption, float HighAbsorption, const FAcousticListenerData& Listener) const;
 
     /** Compute occlusion factor from ray hit */
     float ComputeOcclusionFactor(const FAcousticRayHit& Hit) const;
@@ -248,30 +685,128 @@ protected:
     /** Generate hemisphere ray directions */
     void GenerateHemisphereRays(const FVector& Normal, int32 NumRays, TArray<FVector>& OutDirections) const;
 
+    /** Ticker callback */
+    bool TickSubsystem(float DeltaTime);
+
+    /** Pull listener transforms from local player controllers */
+    void UpdateListenersFromPlayers();
+
+    /** Draw debug visualization */
+    void DrawDebugVisualization();
+
     // ========================================================================
     // DATA
     // ========================================================================
 
-    /** Registered acoustic sources */
-    UPROPERTY()
-    TMap<int32, FAcousticSourceEntry> RegisteredSources;
+    /** Registered acoustic sources (dense SoA storage) */
+    FAcousticSourceRegistry Sources;
 
     /** Listener data array */
     UPROPERTY()
     TArray<FAcousticListenerData> ListenerDataArray;
 
+    /** Shared reflection probes, one per listener */
+    TArray<FAcousticReflectionProbe> ReflectionProbes;
+
+    /** Number of sources with an async occlusion trace in flight */
+    int32 NumPendingOcclusionTraces = 0;
+
     /** Registered zones */
     UPROPERTY()
     TArray<TWeakObjectPtr<AAcousticZoneVolume>> RegisteredZones;
 
+    /** Grid over registered zone bounds */
+    FAcousticZoneIndex ZoneIndex;
+
+    /** Zone grid needs a rebuild */
+    bool bZoneIndexDirty = true;
+
+    /** Grid over source positions for candidate gathering */
+    FAcousticSourceGrid SourceGrid;
+
+    /** Sources that registered or reported a move since the last update, each listed once */
+    TArray<int32> MovedSourceIds;
+
+    /** Source IDs gathered by the last update */
+    TArray<int32> GatheredSourceIds;
+
+    /** Incremented once per gather, compared against FAcousticSourceRegistry::GatherStamps */
+    uint32 GatherStamp = 0;
+
+    /** Every source's zone node has to be looked up again (zones or portals changed) */
+    bool bSourceZonesDirty = true;
+
+    /** Source zone nodes were being kept up to date last update */
+    bool bTrackingSourceZones = false;
+
+    /** Zone per listener, resolved once per frame */
+    TArray<TWeakObjectPtr<AAcousticZoneVolume>> ListenerZones;
+
+    /** Zone preset per listener, resolved once per frame */
+    TArray<FAcousticZonePreset> ListenerZonePresets;
+
+    /** Baked reflection probes per listener, resolved once per frame */
+    TArray<FAcousticBakedProbeSample> ListenerProbeSamples;
+
+    /** Frame the listener zone cache was filled on */
+    uint64 ListenerZoneCacheFrame = 0;
+
     /** Registered portals */
     UPROPERTY()
     TArray<TWeakObjectPtr<AAcousticPortalVolume>> RegisteredPortals;
 
-    /** Material mappings */
+    /** Zone/portal adjacency with cached routes */
+    FAcousticPortalGraph PortalGraph;
+
+    /** Zones or portals were registered or removed since the graph was built */
+    bool bPortalGraphDirty = true;
+
+    /** Portals whose openness changed since the last update */
+    TArray<TWeakObjectPtr<AAcousticPortalVolume>> ChangedPortals;
+
+    /** Runtime material mappings registered by name (override the profile) */
     UPROPERTY()
     TMap<FName, FAcousticMaterial> MaterialMappings;
 
+    /**
+     * Compiled materials. Slots [0, SurfaceType_Max) are indexed directly by
+     * EPhysicalSurface; physical materials mapped by name get extra slots.
+     */
+    TArray<FAcousticMaterial> MaterialTable;
+
+    /** Surface types that have an explicit mapping in the table */
+    TBitArray<> MappedSurfaces;
+
+    /** Table slot per name-mapped physical material */
+    TMap<FName, uint8> NamedMaterialSlots;
+
+    /** Resolved slot per physical material (name mapping first, then surface slot) */
+    mutable TMap<TWeakObjectPtr<const UPhysicalMaterial>, uint8> PhysMatIndexCache;
+
+    /** Guards PhysMatIndexCache, which worker updates fill on first hit */
+    mutable FRWLock MaterialCacheLock;
+
+    /** Baked data of the bake volumes currently loaded */
+    UPROPERTY()
+    TArray<UAcousticBakedData*> ActiveBakedData;
+
+    /** Acoustic BVH over static geometry */
+    FAcousticGeometryScene GeometryScene;
+
+    /** Geometry scene needs a rebuild */
+    bool bGeometrySceneDirty = false;
+
+    /** Actors spawned since the last update, added to the geometry scene when it begins */
+    TArray<TWeakObjectPtr<AActor>> PendingSceneActors;
+
+    /** Level streaming and spawn delegate handles */
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+    FDelegateHandle ActorSpawnedHandle;
+
+    /** Material used when nothing else applies */
+    FAcousticMaterial DefaultMaterial;
+
     /** Current audio output mode */
     UPROPERTY()
     EAudioOutputMode CurrentOutputMode = EAudioOutputMode::Speakers;
@@ -283,14 +818,38 @@ protected:
     /** Current frame ray budget */
     FRayBudgetAllocation CurrentBudget;
 
-    /** Next source ID */
-    int32 NextSourceId = 1;
+    /** Ray budget of the last completed update */
+    FRayBudgetAllocation PublishedBudget;
+
+    /** Inputs to the current simulation update */
+    FAcousticSimulationFrame SimulationFrame;
+
+    /** Worker update in flight (async simulation) */
+    UE::Tasks::FTask SimulationTask;
+
+    /** Garbage collection waits for the worker update, which reads baked data and zone presets */
+    FDelegateHandle PreGarbageCollectHandle;
+
+    /** A finished update has not been delivered to components yet */
+    bool bSimulationResultsPending = false;
+
+    /** Frame time accumulated while a worker update overran */
+    float SimulationDeltaTime = 0.0f;
+
+    /** Source params by dense index, served to queries while a worker update runs */
+    TArray<FAcousticSourceParams> PublishedParams;
+
+    /** Audible source count, served to queries while a worker update runs */
+    int32 PublishedActiveSources = 0;
+
+    /** Occlusion invalidation spheres queued until the next update begins */
+    TArray<FSphere> PendingOcclusionInvalidations;
 
-    /** Accumulated time for occlusion updates */
-    float OcclusionUpdateAccumulator = 0.0f;
+    /** Changes gathered for the batched params event, reused across updates */
+    TArray<FAcousticParamsChange> ParamChangeBatch;
 
-    /** Accumulated time for reflection updates */
-    float ReflectionUpdateAccumulator = 0.0f;
+    /** Unspent ray quota carried into the next frame */
+    float RayQuotaCarry = 0.0f;
 
     /** Accumulated time for zone updates */
     float ZoneUpdateAccumulator = 0.0f;
@@ -0,0 +1,182 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/ObjectKey.h"
+#include "AcousticBVH.h"
+#include "AcousticTypes.h"
+
+class AActor;
+class UWorld;
+class UStaticMesh;
+class UStaticMeshComponent;
+class UPhysicalMaterial;
+
+/**
+ * Acoustic Geometry Scene
+ *
+ * Acoustic-only copy of the geometry that blocks the audio channel, traced
+ * with FAcousticBVH instead of the physics scene. It is a two-level
+ * structure: every static mesh gets one bottom-level BVH over a low render
+ * LOD in mesh space, shared by all its instances, and a top-level BVH over
+ * the world bounds of the instances. Each triangle keeps its mesh section,
+ * and each instance maps sections to proxy materials, which are resolved to
+ * material table slots whenever the table is rebuilt.
+ *
+ * Movable instances are polled every update. When any moved, the top level
+ * is refit in place, or rebuilt once refits have loosened it too far, so
+ * doors and vehicles stay correct without touching a single triangle.
+ *
+ * Meshes whose render data is not CPU-readable (cooked without Allow CPU
+ * Access) are skipped and left to the physics scene. Changes happen on the
+ * game thread between simulation updates; queries are read-only.
+ */
+class ACOUSTICENGINE_API FAcousticGeometryScene
+{
+public:
+    /** Gather every static mesh in a world that blocks Channel and build both levels */
+    void Build(UWorld* World, ECollisionChannel Channel, int32 ProxyLOD);
+
+    /** Add the static meshes of a spawned actor (the top level is rebuilt on the next UpdateInstances) */
+    void AddActor(const AActor* Actor, ECollisionChannel Channel, int32 ProxyLOD);
+
+    /**
+     * Pick up added instances and moved or destroyed movable instances, and
+     * refit or rebuild the top level. World bounds before and after each
+     * change are appended to OutChangedBounds. Returns the number of
+     * instances that moved
+     */
+    int32 UpdateInstances(TArray<FBox>& OutChangedBounds);
+
+    /** Drop all geometry */
+    void Reset();
+
+    /** Map every proxy material to its material table slot */
+    void ResolveMaterials(TFunctionRef<uint8(const UPhysicalMaterial*)> ResolveMaterialIndex);
+
+    /** Nearest hit between two points; false if the segment is clear */
+    bool TraceSingle(const FVector& Start, const FVector& End, FAcousticRayHit& OutHit, bool bMovableOnly = false) const;
+
+    /** Trace unit directions from one origin, four rays per packet. OutHits must match Directions in size */
+    void TraceRays(const FVector& Origin, TConstArrayView<FVector> Directions, float MaxDistance, TArrayView<FAcousticRayHit> OutHits) const;
+
+    /** Trace one packet of rays */
+    void TracePacket(const FAcousticRayPacket& Packet, FAcousticRayHit OutHits[FAcousticRayPacket::Width]) const;
+
+    bool IsEmpty() const { return Instances.Num() == 0; }
+    int32 GetNumInstances() const { return Instances.Num(); }
+    int32 GetNumMovableInstances() const { return MovableInstances.Num(); }
+    int32 GetNumMeshes() const { return Meshes.Num(); }
+
+    /** Triangles across all bottom-level BVHs (each shared mesh counted once) */
+    int32 GetNumTriangles() const;
+
+    /** Meshes skipped because their render data was not CPU-readable */
+    int32 GetNumSkippedMeshes() const { return NumSkippedMeshes; }
+
+    /** Refit top-level cost, relative to the cost at its last rebuild, that triggers a rebuild */
+    static constexpr float RefitRebuildRatio = 1.5f;
+
+private:
+    /** Bottom level: one proxy mesh in mesh space */
+    struct FMeshProxy
+    {
+        FAcousticBVH BVH;
+
+        /** Unit mesh-space normal per triangle (build order) */
+        TArray<FVector3f> TriangleNormals;
+
+        /** Mesh section per triangle (build order) */
+        TArray<uint16> TriangleSections;
+
+        /** Component material slot per mesh section */
+        TArray<int32> SectionMaterialSlots;
+    };
+
+    /** Top level: one placement of a proxy mesh */
+    struct FInstance
+    {
+        TWeakObjectPtr<const UStaticMeshComponent> Component;
+
+        /** Instance of an instanced static mesh component, INDEX_NONE for plain components */
+        int32 InstanceIndex = INDEX_NONE;
+
+        /** Index into Meshes */
+        int32 Mesh = INDEX_NONE;
+
+        /** First of the mesh's per-section entries in SectionMaterials */
+        int32 FirstSectionMaterial = 0;
+
+        FTransform Transform;
+        FMatrix44f LocalToWorld;
+        FMatrix44f WorldToLocal;
+        FBox3f WorldBounds;
+
+        bool bMovable = false;
+    };
+
+    /** Should a component be part of the scene */
+    static bool ShouldIncludeComponent(const UStaticMeshComponent* Component, ECollisionChannel Channel);
+
+    /** Add one component's instances */
+    void AddComponent(const UStaticMeshComponent* Component, int32 ProxyLOD);
+
+    /** Bottom-level proxy for a mesh, built on first use. INDEX_NONE if the mesh has no CPU-readable data */
+    int32 FindOrAddMesh(const UStaticMesh* Mesh, int32 ProxyLOD);
+
+    /** Current world transform of an instance's source */
+    static bool GetInstanceTransform(const FInstance& Instance, FTransform& OutTransform);
+
+    /** Set an instance's transform, matrices and world bounds */
+    void SetInstanceTransform(FInstance& Instance, const FTransform& Transform) const;
+
+    /** Rebuild the top level over the current instances */
+    void RebuildTopLevel();
+
+    /** Proxy material id for a physical material */
+    uint16 FindOrAddProxyMaterial(const UPhysicalMaterial* PhysMat);
+
+    /** Nearest hit of a world ray against one instance; shortens MaxDistance on a hit */
+    bool IntersectInstance(int32 InstanceIndex, const FVector3f& Origin, const FVector3f& Direction, float& MaxDistance, int32& OutTriangle) const;
+
+    /** Convert an instance hit into an acoustic hit */
+    void FillHit(int32 InstanceIndex, int32 Triangle, float Distance, const FVector3f& Origin, const FVector3f& Direction, FAcousticRayHit& OutHit) const;
+
+    /** Bottom-level proxies */
+    TArray<FMeshProxy> Meshes;
+
+    /** Proxy index per mesh (INDEX_NONE for meshes without CPU data) */
+    TMap<TObjectKey<UStaticMesh>, int32> MeshLookup;
+
+    /** Placed instances */
+    TArray<FInstance> Instances;
+
+    /** Indices of movable instances, polled every update */
+    TArray<int32> MovableInstances;
+
+    /** Top-level BVH over instance world bounds */
+    FAcousticBVH TopLevel;
+
+    /** World bounds per instance, as the top level was last built or refit from */
+    TArray<FBox3f> InstanceBounds;
+
+    /** Top-level tree cost right after its last rebuild */
+    float TopLevelBuildCost = 0.0f;
+
+    /** Instances were added or removed since the top level was built */
+    bool bTopLevelDirty = false;
+
+    /** Proxy material id per instance section */
+    TArray<uint16> SectionMaterials;
+
+    /** Physical material per proxy material id */
+    TArray<TWeakObjectPtr<const UPhysicalMaterial>> ProxyMaterials;
+
+    /** Material table slot per proxy material id */
+    TArray<uint8> ProxyMaterialIndices;
+
+    /** Meshes skipped for lack of CPU-readable data */
+    int32 NumSkippedMeshes = 0;
+};
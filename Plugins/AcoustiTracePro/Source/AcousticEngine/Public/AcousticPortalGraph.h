@@ -0,0 +1,154 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+#include "UObject/ObjectKey.h"
+
+class AAcousticZoneVolume;
+class AAcousticPortalVolume;
+
+/**
+ * Indirect sound path from a source to the listener through open portals
+ */
+struct FAcousticPortalPath
+{
+    /** Source -> portals -> listener (cm) */
+    float PathLength = 0.0f;
+
+    /** Product of the transmission of every portal on the path */
+    float Transmission = 1.0f;
+
+    /** Lowest portal LPF cutoff on the path (Hz) */
+    float LPFCutoff = 20000.0f;
+
+    /** Portal the sound reaches the listener's zone through */
+    FVector ArrivalLocation = FVector::ZeroVector;
+
+    /** Portals crossed */
+    int32 NumPortals = 0;
+};
+
+/**
+ * Zone nodes a listener can hear through open portals
+ */
+struct FAcousticAudibleZoneSet
+{
+    /** Node the set was computed from */
+    int32 ListenerNode = INDEX_NONE;
+
+    /** Graph topology the set was computed against */
+    uint32 TopologyGeneration = 0;
+
+    /** Potentially audible flag per node */
+    TBitArray<> Nodes;
+
+    /** Nodes outside the set (including ones the graph did not know when it was computed) are audible */
+    bool Contains(int32 Node) const { return !Nodes.IsValidIndex(Node) || Nodes[Node]; }
+};
+
+/**
+ * Acoustic Portal Graph
+ *
+ * Zones are nodes and portals are edges between the two zones they connect;
+ * node 0 stands for everything outside a zone. Routes between a pair of
+ * zones are searched with Dijkstra over portal crossings, weighted by the
+ * distance between portal centers, and cached per (source zone, listener
+ * zone) pair. A route only depends on which portals are open, so the cache
+ * is dropped when a portal's openness changes and nothing else.
+ *
+ * The potentially audible set of a listener is every node reachable from
+ * its node through open portals. Zones without any portal have unknown
+ * connectivity and are always in the set. It only changes when a portal
+ * opens or closes, which bumps the topology generation.
+ *
+ * The graph is a snapshot of the portal actors taken on the game thread;
+ * queries run inside the simulation update.
+ */
+class ACOUSTICENGINE_API FAcousticPortalGraph
+{
+public:
+    /** Snapshot zones and portals and drop every cached route */
+    void Build(const TArray<TWeakObjectPtr<AAcousticZoneVolume>>& Zones,
+        const TArray<TWeakObjectPtr<AAcousticPortalVolume>>& Portals, float MinOpenness);
+
+    /** Refresh one portal's openness; drops cached routes if it opened or closed. Returns true if the portal changed */
+    bool UpdatePortal(const AAcousticPortalVolume* Portal, float MinOpenness);
+
+    /** Drop all zones and portals */
+    void Reset();
+
+    /** Node for a zone (0 for none or unknown zones) */
+    int32 FindZoneNode(const AAcousticZoneVolume* Zone) const;
+
+    /** Shortest path through open portals between two zones; false if they are the same zone or not connected */
+    bool FindPath(int32 SourceNode, const FVector& SourceLocation, int32 ListenerNode, const FVector& ListenerLocation,
+        FAcousticPortalPath& OutPath);
+
+    /** Nodes reachable from a listener node through open portals */
+    void ComputeAudibleSet(int32 ListenerNode, FAcousticAudibleZoneSet& OutSet) const;
+
+    /** Does a set still match the graph for a listener node */
+    bool IsAudibleSetCurrent(const FAcousticAudibleZoneSet& Set, int32 ListenerNode) const
+    {
+        return Set.ListenerNode == ListenerNode && Set.TopologyGeneration == TopologyGeneration;
+    }
+
+    bool IsEmpty() const { return Portals.Num() == 0; }
+    int32 GetNumPortals() const { return Portals.Num(); }
+    int32 GetNumCachedRoutes() const { return RouteCache.Num(); }
+    uint32 GetTopologyGeneration() const { return TopologyGeneration; }
+
+    /** Node standing for locations outside every zone */
+    static constexpr int32 OutsideNode = 0;
+
+private:
+    struct FPortal
+    {
+        TWeakObjectPtr<const AAcousticPortalVolume> Actor;
+        FVector Center = FVector::ZeroVector;
+
+        /** Zone nodes on either side */
+        int32 NodeA = OutsideNode;
+        int32 NodeB = OutsideNode;
+
+        float Transmission = 1.0f;
+        float LPFCutoff = 20000.0f;
+        bool bOpen = true;
+    };
+
+    /** Portals crossed in order from the source zone, or none if unreachable */
+    struct FRoute
+    {
+        TArray<int32, TInlineAllocator<4>> Portals;
+        bool bReachable = false;
+    };
+
+    /** Copy an actor's openness into a portal snapshot; true if it changed */
+    static bool RefreshPortal(FPortal& Portal, const AAcousticPortalVolume& Actor, float MinOpenness);
+
+    /** Search the shortest route between two zone nodes */
+    void SearchRoute(int32 FromNode, int32 ToNode, FRoute& OutRoute) const;
+
+    /** Portal snapshots */
+    TArray<FPortal> Portals;
+
+    /** Portal index per portal actor */
+    TMap<TObjectKey<AAcousticPortalVolume>, int32> PortalLookup;
+
+    /** Node per zone actor */
+    TMap<TObjectKey<AAcousticZoneVolume>, int32> ZoneNodes;
+
+    /** Bounds center per node, the end points of a route search (unset for the outside node) */
+    TArray<TOptional<FVector>> NodeCenters;
+
+    /** Portals touching each node */
+    TArray<TArray<int32>> NodePortals;
+
+    /** Routes per (source node, listener node) */
+    TMap<uint64, FRoute> RouteCache;
+
+    /** Bumped on every build and whenever a portal opens or closes */
+    uint32 TopologyGeneration = 1;
+};
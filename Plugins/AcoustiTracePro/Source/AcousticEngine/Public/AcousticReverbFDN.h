@@ -0,0 +1,70 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Acoustic Reverb FDN
+ *
+ * Eight-line feedback delay network for the zone reverb's late tail. The
+ * lines share one interleaved, power-of-two delay buffer: every frame holds
+ * one sample per line, so all eight lines are written with two aligned
+ * vector stores and read back with a single masked index per line. Each
+ * sample the line outputs are damped, scaled by their decay gain and mixed
+ * through an orthonormal 8x8 Hadamard matrix, all in SIMD across lines.
+ *
+ * Decay gains and damping coefficients are computed per block, and only
+ * when the settings changed. Even lines feed the left output, odd lines
+ * the right.
+ */
+class ACOUSTICENGINE_API FAcousticReverbFDN
+{
+public:
+    static constexpr int32 NumLines = 8;
+
+    /** Size the delay buffer for a sample rate and clear all state */
+    void Init(float InSampleRate);
+
+    /** Clear the delay buffer and filter state */
+    void Reset();
+
+    /** Per-line decay gains from RT60 and damping from the HF/LF decay multipliers; cheap when nothing changed */
+    void SetDecay(float RT60, float HFDecay, float LFDecay);
+
+    /** Run one block of mono input into left and right tail outputs */
+    void ProcessBlock(const float* Input, float* OutLeft, float* OutRight, int32 NumFrames);
+
+private:
+    /** Line lengths at 44.1 kHz, mutually prime so their echoes don't line up */
+    static constexpr int32 BaseDelays[NumLines] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+
+    /** One frame of NumLines samples per delay position */
+    TArray<float, TAlignedHeapAllocator<16>> Buffer;
+
+    /** Delay positions minus one (the position count is a power of two) */
+    uint32 Mask = 0;
+
+    /** Position the next frame is written to */
+    uint32 WritePos = 0;
+
+    /** Line lengths in samples */
+    int32 Delays[NumLines] = {};
+
+    /** Per-line feedback gain for the current RT60 */
+    alignas(16) float DecayGains[NumLines] = {};
+
+    /** One-pole damping states per line */
+    alignas(16) float LPFStates[NumLines] = {};
+    alignas(16) float HPFStates[NumLines] = {};
+
+    float HFCoeff = 0.0f;
+    float LFCoeff = 0.0f;
+
+    /** Settings the coefficients were computed for */
+    float LastRT60 = -1.0f;
+    float LastHFDecay = -1.0f;
+    float LastLFDecay = -1.0f;
+
+    float SampleRate = 48000.0f;
+};
@@ -8,6 +8,8 @@
 #include "AcousticTypes.h"
 #include "AcousticSettings.generated.h"
 
+class UAcousticProfileAsset;
+
 /**
  * Global acoustic engine settings - accessible via Project Settings
  */
@@ -51,6 +53,82 @@ public:
     UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Quality", meta = (ClampMin = "24", ClampMax = "128"))
     int32 HeroReflectionRays = 32;
 
+    /** Issue occlusion/reflection traces as async scene queries (results are consumed one frame later) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Async")
+    bool bUseAsyncTraces = false;
+
+    /** Run priority scoring, tracing and parameter derivation on a worker task when the geometry scene serves all traces (results are applied one frame later) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Async")
+    bool bUseAsyncSimulation = false;
+
+    /** Scheduler credit a waiting Basic source earns per occlusion update */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Scheduler", meta = (ClampMin = "0.1", ClampMax = "16.0"))
+    float BasicSchedulerWeight = 1.0f;
+
+    /** Scheduler credit a waiting Advanced source earns per occlusion update */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Scheduler", meta = (ClampMin = "0.1", ClampMax = "16.0"))
+    float AdvancedSchedulerWeight = 2.0f;
+
+    /** Scheduler credit a waiting Hero source earns per occlusion update */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Scheduler", meta = (ClampMin = "0.1", ClampMax = "16.0"))
+    float HeroSchedulerWeight = 4.0f;
+
+    /** Occlusion older than this is served ahead of everything else (seconds) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Scheduler", meta = (ClampMin = "0.05", ClampMax = "5.0"))
+    float MaxOcclusionStaleness = 0.5f;
+
+    /** Reuse occlusion results while neither the source nor the listener left the result's validity region */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Occlusion Cache")
+    bool bEnableOcclusionCache = true;
+
+    /** Validity region radius as a fraction of the source-listener distance */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Occlusion Cache", meta = (ClampMin = "0.0", ClampMax = "0.25", EditCondition = "bEnableOcclusionCache"))
+    float OcclusionCacheToleranceRatio = 0.02f;
+
+    /** Smallest validity region radius (cm) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Occlusion Cache", meta = (ClampMin = "0.0", ClampMax = "500.0", EditCondition = "bEnableOcclusionCache"))
+    float OcclusionCacheMinTolerance = 10.0f;
+
+    /** Cached occlusion is re-traced after this long even if nothing moved (seconds) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Occlusion Cache", meta = (ClampMin = "0.1", ClampMax = "30.0", EditCondition = "bEnableOcclusionCache"))
+    float OcclusionCacheMaxAge = 2.0f;
+
+    /** Answer Basic LOD occlusion from baked data where an Acoustic Bake Volume covers both ends */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Baked Occlusion")
+    bool bUseBakedOcclusion = true;
+
+    /** Still trace movable geometry for sources answered from baked data */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Baked Occlusion", meta = (EditCondition = "bUseBakedOcclusion"))
+    bool bTraceDynamicOccluders = true;
+
+    /** Serve Advanced LOD reflections from baked probes while the listener is inside a bake */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Baked Reflections")
+    bool bUseBakedReflections = true;
+
+    /** How far baked decay times override the zone preset (0 = zone only, 1 = baked only) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Baked Reflections", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bUseBakedReflections"))
+    float BakedReverbBlend = 1.0f;
+
+    /** Trace static geometry against the acoustic BVH instead of the physics scene (movable geometry still uses physics) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Geometry Scene")
+    bool bUseAcousticGeometryScene = false;
+
+    /** Render LOD used as the acoustic proxy of a static mesh (clamped to the mesh's last LOD) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Geometry Scene", meta = (ClampMin = "0", ClampMax = "7", EditCondition = "bUseAcousticGeometryScene"))
+    int32 AcousticProxyLOD = 2;
+
+    /** Route occluded sources around walls through open portals between zones */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Portals")
+    bool bEnablePortalPropagation = true;
+
+    /** Portals less open than this are closed to propagation */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Portals", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bEnablePortalPropagation"))
+    float MinPortalOpenness = 0.05f;
+
+    /** Skip sources in zones no listener can reach through open portals; they hold a fully occluded result without tracing */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Ray Tracing|Portals")
+    bool bCullUnreachableZones = true;
+
     // ========================================================================
     // UPDATE RATES
     // ========================================================================
@@ -67,10 +145,26 @@ public:
     UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Update Rates", meta = (ClampMin = "5.0", ClampMax = "60.0"))
     float ZoneUpdateRateHz = 20.0f;
 
+    /** Occlusion/reflection rate multiplier for Basic LOD sources */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Update Rates", meta = (ClampMin = "0.1", ClampMax = "4.0"))
+    float BasicUpdateRateScale = 0.5f;
+
+    /** Occlusion/reflection rate multiplier for Advanced LOD sources */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Update Rates", meta = (ClampMin = "0.1", ClampMax = "4.0"))
+    float AdvancedUpdateRateScale = 1.0f;
+
+    /** Occlusion/reflection rate multiplier for Hero LOD sources */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Update Rates", meta = (ClampMin = "0.1", ClampMax = "4.0"))
+    float HeroUpdateRateScale = 2.0f;
+
     /** Number of frames to cache occlusion data for non-priority sources */
     UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Update Rates", meta = (ClampMin = "1", ClampMax = "30"))
     int32 OcclusionCacheFrames = 5;
 
+    /** Cell size of the zone lookup grid in cm */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Update Rates", meta = (ClampMin = "200.0", ClampMax = "20000.0"))
+    float ZoneGridCellSize = 2000.0f; // 20 meters
+
     // ========================================================================
     // LOD THRESHOLDS
     // ========================================================================
@@ -115,6 +209,38 @@ public:
     UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Mix", meta = (ClampMin = "0.0", ClampMax = "2.0"))
     float EarlyReflectionScale = 1.0f;
 
+    // ========================================================================
+    // PARAMETER UPDATES
+    // ========================================================================
+
+    /** Minimum occlusion change that is pushed to a source */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Parameter Updates", meta = (ClampMin = "0.0", ClampMax = "0.2"))
+    float OcclusionChangeThreshold = 0.01f;
+
+    /** Minimum relative filter cutoff change that is pushed to a source (0.02 = 2%) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Parameter Updates", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+    float FilterCutoffChangeRatio = 0.02f;
+
+    /** Minimum transmission/dry/tap gain change that is pushed to a source */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Parameter Updates", meta = (ClampMin = "0.0", ClampMax = "0.2"))
+    float GainChangeThreshold = 0.01f;
+
+    /** Minimum reverb send change that is pushed to a source */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Parameter Updates", meta = (ClampMin = "0.0", ClampMax = "0.2"))
+    float ReverbSendChangeThreshold = 0.01f;
+
+    /** Minimum spatial width / HRTF spread change that is pushed to a source */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Parameter Updates", meta = (ClampMin = "0.0", ClampMax = "0.2"))
+    float SpatialWidthChangeThreshold = 0.02f;
+
+    /** Minimum early reflection tap delay change that is pushed to a source (ms) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Parameter Updates", meta = (ClampMin = "0.0", ClampMax = "10.0"))
+    float ReflectionDelayChangeThresholdMs = 0.5f;
+
+    /** Minimum listener distance change that is pushed to a source (cm) */
+    UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Parameter Updates", meta = (ClampMin = "0.0", ClampMax = "1000.0"))
+    float DistanceChangeThreshold = 50.0f;
+
     // ========================================================================
     // HEADPHONE MODE
     // ========================================================================
@@ -151,6 +277,14 @@ public:
     UPROPERTY(config, EditAnywhere, BlueprintReadWrite, Category = "Collision")
     bool bUseComplexCollision = false;
 
+    // ========================================================================
+    // PROFILE
+    // ========================================================================
+
+    /** Acoustic profile providing material mappings and zone presets */
+    UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Profile")
+    TSoftObjectPtr<UAcousticProfileAsset> AcousticProfile;
+
     // ========================================================================
     // DEBUG
     // ========================================================================
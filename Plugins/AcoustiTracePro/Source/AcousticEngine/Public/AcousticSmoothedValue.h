@@ -0,0 +1,87 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Shape of a parameter ramp */
+enum class EAcousticRampType : uint8
+{
+    /** Reaches the target in exactly the ramp time */
+    Linear,
+
+    /** One-pole approach with the ramp time as time constant */
+    Exponential
+};
+
+/**
+ * Acoustic Smoothed Value
+ *
+ * Control-rate parameter smoothing for DSP code. The value moves toward its
+ * target once per block; inside the block, callers interpolate linearly from
+ * GetBlockStart() to GetValue(). Ramp times are in seconds, so smoothing
+ * sounds the same at every sample rate and block size.
+ *
+ * Once the target is reached the value snaps to it and IsSettled() turns
+ * true, which is the cue to run a constant-coefficient fast path.
+ */
+class ACOUSTICENGINE_API FAcousticSmoothedValue
+{
+public:
+    FAcousticSmoothedValue() = default;
+    explicit FAcousticSmoothedValue(float InValue) { SetValue(InValue); }
+
+    /** Set sample rate, ramp time and shape; keeps the current value and target */
+    void Init(float InSampleRate, float InRampSeconds, EAcousticRampType InType = EAcousticRampType::Linear);
+
+    /** Change the ramp time; a linear ramp in progress restarts from the current value */
+    void SetRampTime(float InRampSeconds);
+
+    /** Ramp toward a new target from the current value */
+    void SetTarget(float InTarget);
+
+    /** Jump to a value with no ramp */
+    void SetValue(float InValue);
+
+    /** Move one block toward the target */
+    void Advance(int32 NumFrames);
+
+    /** Value at the start of the last advanced block */
+    float GetBlockStart() const { return BlockStart; }
+
+    /** Value at the end of the last advanced block */
+    float GetValue() const { return Value; }
+
+    float GetTarget() const { return Target; }
+
+    /** Per-frame increment that interpolates across the last advanced block (0 once settled) */
+    float GetBlockStep() const { return BlockStep; }
+
+    /** Target reached and the last block was constant */
+    bool IsSettled() const { return Value == Target && BlockStart == Target; }
+
+    /** Multiply a buffer by the last block's ramp, or by a constant once settled */
+    void ApplyGain(float* Buffer, int32 NumFrames) const;
+
+private:
+    /** Start a linear ramp from the current value to the target */
+    void StartRamp();
+
+    EAcousticRampType Type = EAcousticRampType::Linear;
+
+    float SampleRate = 48000.0f;
+    float RampSeconds = 0.02f;
+
+    float Value = 0.0f;
+    float Target = 0.0f;
+    float BlockStart = 0.0f;
+    float BlockStep = 0.0f;
+
+    /** Linear ramp: increment per frame and frames left */
+    float LinearStep = 0.0f;
+    int32 LinearFramesLeft = 0;
+
+    /** Exponential ramp: per-block decay, cached for the last block size */
+    float ExpBlockCoeff = 0.0f;
+    int32 ExpBlockFrames = 0;
+};
@@ -10,6 +10,7 @@
 class UAudioComponent;
 class USoundBase;
 class UAcousticEngineSubsystem;
+struct FAcousticSourcePriorityInputs;
 
 /**
  * Source flags for special behavior
@@ -52,7 +53,6 @@ public:
 
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 #if WITH_EDITOR
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -202,20 +202,49 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Acoustic|MetaSound")
     static FName GetSpatialWidthParamName() { return FName("Acoustic_SpatialWidth"); }
 
+    /** Get parameter name for the portal path gain */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic|MetaSound")
+    static FName GetPortalGainParamName() { return FName("Acoustic_PortalGain"); }
+
+    /** Get parameter name for the portal path delay */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic|MetaSound")
+    static FName GetPortalDelayParamName() { return FName("Acoustic_PortalDelayMs"); }
+
+    /** Get parameter name for an early reflection tap's delay (Acoustic_Tap0_DelayMs ...) */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic|MetaSound")
+    static FName GetReflectionTapDelayParamName(int32 TapIndex);
+
+    /** Get parameter name for an early reflection tap's gain */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic|MetaSound")
+    static FName GetReflectionTapGainParamName(int32 TapIndex);
+
+    /** Get parameter name for an early reflection tap's LPF cutoff */
+    UFUNCTION(BlueprintCallable, Category = "Acoustic|MetaSound")
+    static FName GetReflectionTapLPFParamName(int32 TapIndex);
+
     // ========================================================================
     // INTERNAL
     // ========================================================================
 
-    /** Called by engine when params are updated */
+    /** Called by engine when params changed beyond their thresholds; pushes them to audio */
     void OnParamsUpdated(const FAcousticSourceParams& NewParams);
 
     /** Get computed priority score */
     float ComputePriorityScore(const FVector& ListenerLocation) const;
 
+    /** Get computed priority score for an already-known listener distance */
+    float ComputePriorityScoreForDistance(float Distance) const;
+
+    /** Snapshot the state priority scoring reads */
+    FAcousticSourcePriorityInputs GetPriorityInputs() const;
+
     /** Get world location for acoustic calculations */
     FVector GetAcousticLocation() const;
 
 protected:
+    /** Report moves to the engine's source grid */
+    virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
     /** Register with the acoustic engine */
     void RegisterWithEngine();
 
@@ -234,6 +263,34 @@ protected:
     /** Cached subsystem reference */
     UPROPERTY()
     UAcousticEngineSubsystem* CachedSubsystem = nullptr;
+
+    /** Values last sent to the linked audio component (negative = never sent) */
+    struct FPushedAudioParams
+    {
+        float Occlusion = -1.0f;
+        float LowPassCutoff = -1.0f;
+        float ReverbSend = -1.0f;
+        float SpatialWidth = -1.0f;
+        float PortalGain = -1.0f;
+        float PortalDelayMs = -1.0f;
+        float VolumeMultiplier = -1.0f;
+        float TapDelayMs[FEarlyReflectionParams::MaxTaps];
+        float TapGain[FEarlyReflectionParams::MaxTaps];
+        float TapLPFCutoff[FEarlyReflectionParams::MaxTaps];
+
+        FPushedAudioParams()
+        {
+            for (int32 Tap = 0; Tap < FEarlyReflectionParams::MaxTaps; Tap++)
+            {
+                TapDelayMs[Tap] = -1.0f;
+                TapGain[Tap] = -1.0f;
+                TapLPFCutoff[Tap] = -1.0f;
+            }
+        }
+    };
+
+    /** Last pushed audio values, so unchanged parameters are not re-sent */
+    FPushedAudioParams PushedAudioParams;
 };
 
 // ============================================================================
@@ -0,0 +1,63 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Acoustic Source Grid
+ *
+ * Uniform hash grid over source positions, keyed by generational source ID
+ * so it survives dense reordering in the registry. Sources are moved only
+ * when their component reports a transform change, and a radius query
+ * visits only the cells the sphere overlaps, so gathering the sources near
+ * a listener costs in proportion to the sources nearby rather than to every
+ * registered source.
+ */
+class ACOUSTICENGINE_API FAcousticSourceGrid
+{
+public:
+    /** Drop every source */
+    void Reset();
+
+    /** Change the cell size; drops every source, which the caller re-inserts */
+    void SetCellSize(float InCellSize);
+
+    /** Insert a source, or move it if it is already in the grid */
+    void Update(int32 SourceId, const FVector& Location);
+
+    /** Is the source stored in the cell containing Location */
+    bool IsInCellOf(int32 SourceId, const FVector& Location) const;
+
+    /** Remove a source. Returns false if it was not in the grid */
+    bool Remove(int32 SourceId);
+
+    /** Append the IDs of every source within Radius of Center */
+    void GatherInRadius(const FVector& Center, float Radius, TArray<int32>& OutSourceIds) const;
+
+    float GetCellSize() const { return CellSize; }
+    int32 Num() const { return SourceCells.Num(); }
+    int32 GetNumCells() const { return Cells.Num(); }
+
+private:
+    struct FEntry
+    {
+        int32 SourceId = INDEX_NONE;
+        FVector Location = FVector::ZeroVector;
+    };
+
+    /** Grid cell coordinate for a location */
+    FIntVector GetCell(const FVector& Location) const;
+
+    /** Remove a source from one cell's list */
+    void RemoveFromCell(const FIntVector& Cell, int32 SourceId);
+
+    /** Sources per occupied cell */
+    TMap<FIntVector, TArray<FEntry>> Cells;
+
+    /** Cell each source is currently stored in */
+    TMap<int32, FIntVector> SourceCells;
+
+    /** Grid cell size in cm */
+    float CellSize = 8000.0f;
+};
@@ -0,0 +1,280 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+#include "AcousticTypes.h"
+
+class UAcousticSourceComponent;
+
+/**
+ * Generational source handle helpers
+ *
+ * Source IDs handed out to components and Blueprints are packed handles:
+ * the low bits address a registry slot, the high bits hold the slot's
+ * generation so a stale ID from an unregistered source never aliases the
+ * source that reuses its slot. The sign bit stays clear; -1 is invalid.
+ */
+namespace AcousticSourceHandle
+{
+    constexpr int32 IndexBits = 20;
+    constexpr int32 IndexMask = (1 << IndexBits) - 1;
+    constexpr int32 GenerationMask = 0x7FF;
+
+    inline int32 Make(int32 SlotIndex, int32 Generation)
+    {
+        return ((Generation & GenerationMask) << IndexBits) | (SlotIndex & IndexMask);
+    }
+
+    inline int32 GetSlot(int32 SourceId)
+    {
+        return SourceId & IndexMask;
+    }
+
+    inline int32 GetGeneration(int32 SourceId)
+    {
+        return (SourceId >> IndexBits) & GenerationMask;
+    }
+}
+
+/**
+ * In-flight async occlusion trace for a source
+ */
+struct FAcousticPendingOcclusionTrace
+{
+    /** Async trace handle */
+    FTraceHandle Handle;
+
+    /** Frame the trace was issued on (0 = nothing in flight) */
+    uint64 IssueFrame = 0;
+
+    /** Positions traced between, committed as the cache origins when the result lands */
+    FVector SourceLocation = FVector::ZeroVector;
+    FVector ListenerLocation = FVector::ZeroVector;
+};
+
+/**
+ * Visibility from a source to one cached reflection path vertex
+ */
+struct FAcousticPathVisibility
+{
+    /** Path generation the result was traced against (0 = never traced) */
+    uint32 Generation = 0;
+
+    /** Source location the result was traced to */
+    FVector SourceLocation = FVector::ZeroVector;
+
+    /** Nothing blocks the vertex from the source */
+    bool bVisible = false;
+};
+
+/**
+ * Image of a source mirrored across one or more reflector planes
+ */
+struct FAcousticImageSource
+{
+    /** Mirrored source location */
+    FVector Location = FVector::ZeroVector;
+
+    /** Reflector plane this image was mirrored across (index into the probe's planes) */
+    int32 Plane = INDEX_NONE;
+
+    /** Image this one was mirrored from, INDEX_NONE for first-order images */
+    int32 Parent = INDEX_NONE;
+
+    /** Reflections along the path */
+    int32 Order = 1;
+};
+
+/**
+ * A source's image sources against the reflector planes around the listener
+ *
+ * Images depend only on the source and the planes, so the tree is kept
+ * until either changes; only the visibility of each path is re-traced.
+ */
+struct FAcousticImageTree
+{
+    /** Probe plane generation the tree was built against (0 = never built) */
+    uint32 PlaneGeneration = 0;
+
+    /** Source location the tree was built for */
+    FVector SourceLocation = FVector::ZeroVector;
+
+    /** Highest reflection order in the tree */
+    int32 MaxOrder = 0;
+
+    /** First-order images first, each higher order after its parents */
+    TArray<FAcousticImageSource> Images;
+};
+
+/**
+ * Component state read by priority scoring
+ *
+ * Copied from the component on the game thread once per update, so scoring
+ * and LOD assignment never touch the UObject.
+ */
+struct FAcousticSourcePriorityInputs
+{
+    /** Requested LOD before distance and budget downgrades */
+    EAcousticLOD RequestedLOD = EAcousticLOD::Advanced;
+
+    /** Importance level */
+    EAcousticImportance Importance = EAcousticImportance::Normal;
+
+    /** Loudness estimate */
+    float BaseLoudness = 1.0f;
+
+    /** Explicit priority (negative = computed) */
+    float PriorityOverride = -1.0f;
+
+    /** Source is flagged as a hero */
+    bool bIsHero = false;
+
+    /** Owning component was alive when the snapshot was taken */
+    bool bIsValid = false;
+
+    /** Priority score at a listener distance */
+    ACOUSTICENGINE_API float ComputeScore(float Distance) const;
+};
+
+/**
+ * Per-source data that is only touched when a source is actually updated
+ */
+struct FAcousticSourceColdData
+{
+    /** Current computed parameters */
+    FAcousticSourceParams CurrentParams;
+
+    /** Previous update parameters (for interpolation) */
+    FAcousticSourceParams PreviousParams;
+
+    /** Parameters last pushed to the component (change detection baseline) */
+    FAcousticSourceParams AppliedParams;
+
+    /** Async occlusion trace in flight */
+    FAcousticPendingOcclusionTrace PendingOcclusion;
+
+    /** Visibility per reflection probe path vertex (Hero path tracing) */
+    TArray<FAcousticPathVisibility> PathVisibility;
+
+    /** Image sources against the listener's reflector planes (Hero) */
+    FAcousticImageTree ImageTree;
+};
+
+/**
+ * Acoustic Source Registry
+ *
+ * Dense structure-of-arrays storage for registered sources. Every per-frame
+ * pass walks the hot arrays linearly by dense index; a sparse slot table maps
+ * generational source IDs to dense indices in O(1). Removal swaps the last
+ * dense element into the hole, so arrays stay packed.
+ */
+class ACOUSTICENGINE_API FAcousticSourceRegistry
+{
+public:
+    /** Add a source and return its generational ID */
+    int32 Add(UAcousticSourceComponent* Component);
+
+    /** Remove a source by ID. Returns false if the ID is stale or unknown */
+    bool Remove(int32 SourceId);
+
+    /** Dense index for a source ID, or INDEX_NONE if stale/unknown */
+    int32 FindDense(int32 SourceId) const;
+
+    /** Is this ID currently registered */
+    bool Contains(int32 SourceId) const { return FindDense(SourceId) != INDEX_NONE; }
+
+    /** Number of registered sources */
+    int32 Num() const { return SourceIds.Num(); }
+
+    /** Remove every source */
+    void Reset();
+
+    // ========================================================================
+    // HOT DATA (dense, indexed 0..Num()-1)
+    // ========================================================================
+
+    /** Source ID per dense index */
+    TArray<int32> SourceIds;
+
+    /** Acoustic location, re-read when the component reports a move */
+    TArray<FVector> Positions;
+
+    /** Distance to the primary listener */
+    TArray<float> Distances;
+
+    /** Portal graph node of the zone containing the source, re-resolved on a move or a zone/portal rebuild */
+    TArray<int32> ZoneNodes;
+
+    /** Component state snapshot for priority scoring */
+    TArray<FAcousticSourcePriorityInputs> PriorityInputs;
+
+    /** Priority score for ray budget allocation */
+    TArray<float> PriorityScores;
+
+    /** Effective LOD after budget considerations */
+    TArray<EAcousticLOD> EffectiveLODs;
+
+    /** Last occlusion update time */
+    TArray<double> LastOcclusionUpdateTimes;
+
+    /** Occlusion scheduler credit accumulated while waiting for a ray */
+    TArray<float> OcclusionDeficits;
+
+    /** Last reflection update time */
+    TArray<double> LastReflectionUpdateTimes;
+
+    /** Time the next occlusion update is due (0 = immediately) */
+    TArray<double> NextOcclusionUpdateTimes;
+
+    /** Time the next reflection update is due (0 = immediately) */
+    TArray<double> NextReflectionUpdateTimes;
+
+    /** Hashed update phase in (0, 1], staggers sources that register together */
+    TArray<float> UpdatePhases;
+
+    /** Is this source currently audible */
+    TArray<bool> AudibleFlags;
+
+    /** Source is in a zone no listener can reach through open portals */
+    TArray<bool> ZoneCulledFlags;
+
+    /** Stamp of the last candidate gather that reached this source */
+    TArray<uint32> GatherStamps;
+
+    /** Source is already queued in the moved list for the next update */
+    TArray<bool> MovedFlags;
+
+    /** Source location the cached occlusion was traced from */
+    TArray<FVector> OcclusionSourceOrigins;
+
+    /** Listener location the cached occlusion was traced from */
+    TArray<FVector> OcclusionListenerOrigins;
+
+    /** Cached occlusion may be reused while both ends stay in its validity region */
+    TArray<bool> OcclusionCacheValid;
+
+    // ========================================================================
+    // COLD DATA (dense, indexed 0..Num()-1)
+    // ========================================================================
+
+    /** Owning components */
+    TArray<TWeakObjectPtr<UAcousticSourceComponent>> Components;
+
+    /** Parameters and rarely-touched state */
+    TArray<FAcousticSourceColdData> ColdData;
+
+private:
+    /** Swap-remove a dense element from every array */
+    void RemoveDenseAtSwap(int32 DenseIndex);
+
+    /** Generation per slot */
+    TArray<int32> SlotGenerations;
+
+    /** Dense index per slot (INDEX_NONE when free) */
+    TArray<int32> SlotToDense;
+
+    /** Free slots available for reuse */
+    TArray<int32> FreeSlots;
+};
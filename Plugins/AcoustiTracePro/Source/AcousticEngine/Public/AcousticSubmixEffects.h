@@ -6,6 +6,9 @@
 #include "Sound/SoundEffectSubmix.h"
 #include "DSP/Dsp.h"
 #include "AcousticTypes.h"
+#include "AcousticReverbFDN.h"
+#include "AcousticDelayLine.h"
+#include "AcousticSmoothedValue.h"
 #include "AcousticSubmixEffects.generated.h"
 
 // ============================================================================
@@ -103,6 +106,10 @@ public:
  *
  * Algorithmic reverb effect that can be driven by acoustic zones.
  * Supports smooth blending between different reverb settings.
+ *
+ * Processing runs in block stages: mono sum, early taps, a chain of
+ * allpass diffusers, then an eight-line FDN for the late tail. Settings
+ * and coefficients are resolved once per block.
  */
 UCLASS()
 class ACOUSTICENGINE_API FAcousticZoneReverbEffect : public FSoundEffectSubmix
@@ -123,8 +130,8 @@ private:
     /** Target settings for blending */
     FAcousticZoneReverbSettings TargetSettings;
 
-    /** Blend progress (0-1) */
-    float BlendProgress = 1.0f;
+    /** Blend progress (0-1), ramped linearly over the blend time */
+    FAcousticSmoothedValue BlendAlpha;
 
     /** Is currently blending */
     bool bIsBlending = false;
@@ -138,9 +145,8 @@ private:
     // Reverb DSP components (simplified representation)
     // In practice, these would be more complex structures
 
-    /** Pre-delay buffer */
-    TArray<float> PreDelayBuffer;
-    int32 PreDelayWriteIndex = 0;
+    /** Pre-delay line the early taps read from */
+    FAcousticDelayLine PreDelayLine;
 
     /** Early reflection taps */
     struct FEarlyTap
@@ -154,22 +160,22 @@ private:
     /** Allpass diffusers */
     struct FAllpassDiffuser
     {
-        TArray<float> Buffer;
-        int32 WriteIndex;
-        float Feedback;
+        FAcousticDelayLine Line;
+        int32 Delay = 0;
+        float Feedback = 0.5f;
     };
     TArray<FAllpassDiffuser> Diffusers;
 
-    /** Feedback delay network */
-    struct FFDNTank
-    {
-        TArray<float> Buffer;
-        int32 WriteIndex;
-        float Feedback;
-        float LPFState;
-        float HPFState;
-    };
-    TArray<FFDNTank> FDNTanks;
+    /** Late tail */
+    FAcousticReverbFDN LateFDN;
+
+    /** Per-block scratch, grown to the largest block seen */
+    TArray<float> EarlyScratchL;
+    TArray<float> EarlyScratchR;
+    TArray<float> EarlyTapScratch;
+    TArray<float> LateInputScratch;
+    TArray<float> LateScratchL;
+    TArray<float> LateScratchR;
 
     /** Output processing */
     float OutputLPFState[2] = {0.0f, 0.0f};
@@ -177,15 +183,18 @@ private:
     /** Initialize DSP structures */
     void InitializeDSP();
 
-    /** Process early reflections */
-    void ProcessEarlyReflections(const float* InBuffer, float* OutBuffer, int32 NumFrames);
+    /** Write one block of mono input to the pre-delay line and sum the panned early taps */
+    void ProcessEarlyReflections(const float* MonoInput, float* OutL, float* OutR, int32 NumFrames, const FAcousticZoneReverbSettings& Settings);
 
-    /** Process late reverb (FDN) */
-    void ProcessLateReverb(const float* InBuffer, float* OutBuffer, int32 NumFrames);
+    /** Diffuse one block of late input in place and run it through the FDN */
+    void ProcessLateReverb(float* InOutLateInput, float* OutL, float* OutR, int32 NumFrames, const FAcousticZoneReverbSettings& Settings);
 
     /** Update blend */
     void UpdateBlend(int32 NumFrames);
 
+    /** Restart the blend toward TargetSettings */
+    void StartBlend();
+
     /** Interpolate settings */
     FAcousticZoneReverbSettings InterpolateSettings(float Alpha) const;
 };
@@ -260,9 +269,8 @@ private:
     float SampleRate = 48000.0f;
 
     // Crossfeed delay lines
-    TArray<float> CrossfeedDelayL;
-    TArray<float> CrossfeedDelayR;
-    int32 DelayWriteIndex = 0;
+    FAcousticDelayLine CrossfeedLineL;
+    FAcousticDelayLine CrossfeedLineR;
 
     // LPF state for crossfeed
     float CrossfeedLPFStateL = 0.0f;
@@ -350,6 +358,11 @@ private:
     float LimiterEnvelope = 0.0f;
     float LimiterGain = 1.0f;
 
+    // Coefficients resolved in Init/OnPresetChanged
+    float LimiterThreshold = 1.0f;
+    float AttackCoeff = 0.0f;
+    float ReleaseCoeff = 0.0f;
+
     // Smoothed gain
-    float SmoothedOutputGain = 1.0f;
+    FAcousticSmoothedValue OutputGain;
 };
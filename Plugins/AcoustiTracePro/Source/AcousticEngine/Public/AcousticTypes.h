@@ -261,6 +261,32 @@ struct ACOUSTICENGINE_API FAcousticSourceParams
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reflections")
     FEarlyReflectionParams EarlyReflections;
 
+    // === Portal Propagation ===
+
+    /** An occluded source reaches the listener through open portals */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portals")
+    bool bHasPortalPath = false;
+
+    /** Length of the path through the portals (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portals")
+    float PortalPathLength = 0.0f;
+
+    /** Propagation delay along the portal path */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portals")
+    float PortalDelayMs = 0.0f;
+
+    /** Gain of the portal path relative to the unoccluded direct sound */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portals", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float PortalGain = 0.0f;
+
+    /** LPF cutoff of the most closed portal on the path (Hz) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portals", meta = (ClampMin = "200.0", ClampMax = "20000.0"))
+    float PortalLPFCutoff = 20000.0f;
+
+    /** World-space direction from the listener to the portal the sound arrives through */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portals")
+    FVector PortalDirection = FVector::ZeroVector;
+
     // === Distance ===
 
     /** Actual distance to listener */
@@ -293,6 +319,12 @@ struct ACOUSTICENGINE_API FAcousticSourceParams
         SpatialWidth = 0.0f;
         HRTFSpreadMultiplier = 1.0f;
         EarlyReflections.Reset();
+        bHasPortalPath = false;
+        PortalPathLength = 0.0f;
+        PortalDelayMs = 0.0f;
+        PortalGain = 0.0f;
+        PortalLPFCutoff = 20000.0f;
+        PortalDirection = FVector::ZeroVector;
         Distance = 0.0f;
         PerceivedDistance = 0.0f;
         LastUpdateFrame = 0;
@@ -380,13 +412,13 @@ struct ACOUSTICENGINE_API FAcousticRayHit
     UPROPERTY(BlueprintReadOnly, Category = "Ray Hit")
     float Distance = 0.0f;
 
-    /** Material at hit location */
+    /** Index into the engine's compiled material table (0 = default material) */
     UPROPERTY(BlueprintReadOnly, Category = "Ray Hit")
-    FAcousticMaterial Material;
+    uint8 MaterialIndex = 0;
 
-    /** Physical material name (for lookup) */
+    /** Hit geometry is movable, so the result cannot be cached */
     UPROPERTY(BlueprintReadOnly, Category = "Ray Hit")
-    FName PhysicalMaterialName = NAME_None;
+    bool bIsDynamicHit = false;
 
     /** Is this a valid hit */
     UPROPERTY(BlueprintReadOnly, Category = "Ray Hit")
@@ -430,6 +462,23 @@ struct ACOUSTICENGINE_API FAcousticListenerData
     int32 CurrentZoneId = -1;
 };
 
+/**
+ * Changed parameters for one source, delivered in a per-frame batch
+ */
+USTRUCT(BlueprintType)
+struct ACOUSTICENGINE_API FAcousticParamsChange
+{
+    GENERATED_BODY()
+
+    /** Source the parameters belong to */
+    UPROPERTY(BlueprintReadOnly, Category = "Params Change")
+    int32 SourceId = -1;
+
+    /** New parameters */
+    UPROPERTY(BlueprintReadOnly, Category = "Params Change")
+    FAcousticSourceParams Params;
+};
+
 // ============================================================================
 // DELEGATES
 // ============================================================================
@@ -437,5 +486,21 @@ struct ACOUSTICENGINE_API FAcousticListenerData
 /** Delegate for when acoustic parameters update */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAcousticParamsUpdated, int32, SourceId, const FAcousticSourceParams&, Params);
 
+/** Delegate for the sources whose parameters changed this frame */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAcousticParamsBatchUpdated, const TArray<FAcousticParamsChange>&, Changes);
+
 /** Delegate for zone change events */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAcousticZoneChanged, int32, ListenerId, int32, OldZoneId, int32, NewZoneId);
+
+// ============================================================================
+// DEFAULT PRESETS
+// ============================================================================
+
+namespace AcousticDefaults
+{
+    /** Default material preset for a material type */
+    ACOUSTICENGINE_API FAcousticMaterial GetDefaultMaterial(EAcousticMaterialType Type);
+
+    /** Default zone preset for a zone type */
+    ACOUSTICENGINE_API FAcousticZonePreset GetDefaultZonePreset(EAcousticZoneType Type);
+}
@@ -0,0 +1,62 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AAcousticZoneVolume;
+
+/**
+ * Acoustic Zone Index
+ *
+ * Uniform hash grid over zone bounds for point-in-zone queries. A query
+ * visits only the zones whose bounds overlap the point's cell, in priority
+ * order, and runs the exact brush test last. Zones whose bounds cover more
+ * cells than MaxCellsPerZone are kept in a small oversize list instead of
+ * being rasterized into the grid.
+ */
+class ACOUSTICENGINE_API FAcousticZoneIndex
+{
+public:
+    /** Rebuild the grid from a zone list */
+    void Build(const TArray<TWeakObjectPtr<AAcousticZoneVolume>>& Zones, float InCellSize);
+
+    /** Highest-priority zone containing a point (the first registered on a tie), or nullptr */
+    AAcousticZoneVolume* FindZone(const FVector& Location) const;
+
+    /** Drop all zones */
+    void Reset();
+
+    /** Cells a single zone may occupy before it goes to the oversize list */
+    static constexpr int32 MaxCellsPerZone = 512;
+
+private:
+    struct FIndexedZone
+    {
+        TWeakObjectPtr<AAcousticZoneVolume> Zone;
+        FBox Bounds;
+        int32 Priority = 0;
+    };
+
+    /** Grid cell coordinate for a location */
+    FIntVector GetCell(const FVector& Location) const;
+
+    /** Does zone A win over zone B: higher priority, then earlier registration */
+    bool Outranks(int32 A, int32 B) const;
+
+    /** Test candidates (in rank order) and update the best match */
+    void TestCandidates(const TArray<int32>& Candidates, const FVector& Location,
+        AAcousticZoneVolume*& BestZone, int32& BestIndex) const;
+
+    /** Indexed zones, in registration order */
+    TArray<FIndexedZone> IndexedZones;
+
+    /** Zone indices per occupied cell, in rank order */
+    TMap<FIntVector, TArray<int32>> Cells;
+
+    /** Zones too large to rasterize, in rank order */
+    TArray<int32> OversizeZones;
+
+    /** Grid cell size in cm */
+    float CellSize = 2000.0f;
+};
@@ -138,6 +138,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Acoustic Zone")
     FAcousticZonePreset GetZonePreset() const;
 
+    /** Get the preset cached at BeginPlay (no rebuild) */
+    const FAcousticZonePreset& GetCachedZonePreset() const { return CachedPreset; }
+
     /** Check if a point is inside this zone */
     UFUNCTION(BlueprintCallable, Category = "Acoustic Zone")
     bool ContainsPoint(const FVector& Point) const;
@@ -201,7 +204,7 @@ public:
     bool bIsOpen = true;
 
     /** Current openness (0 = closed, 1 = fully open) */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustic Portal", meta = (ClampMin = "0.0", ClampMax = "1.0"), Replicated)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Acoustic Portal", meta = (ClampMin = "0.0", ClampMax = "1.0"), ReplicatedUsing = OnRep_Openness)
     float Openness = 1.0f;
 
     // ========================================================================
@@ -295,6 +298,13 @@ protected:
     /** Update transition animation */
     void UpdateTransition(float DeltaTime);
 
+    /** Tell the engine the portal state changed */
+    void NotifyEngineOfStateChange();
+
+    /** Replicated openness arrived */
+    UFUNCTION()
+    void OnRep_Openness();
+
     /** Target openness for animation */
     float TargetOpenness = 1.0f;
 
@@ -11,6 +11,8 @@
 #include "MetasoundAudioBuffer.h"
 #include "MetasoundVertex.h"
 #include "AcousticTypes.h"
+#include "AcousticSmoothedValue.h"
+#include "AcousticDelayLine.h"
 
 namespace Metasound
 {
@@ -81,9 +83,11 @@ namespace Metasound
 
         // DSP state
         float SampleRate;
-        float CurrentLPFCoeff;
+        FAcousticSmoothedValue LPFCoeff;
+        FAcousticSmoothedValue Gain;
         float FilterState;
-        float SmoothedGain;
+        float LastLPFCutoff;
+        float LastGainDb;
     };
 
     // ========================================================================
@@ -95,6 +99,9 @@ namespace Metasound
      *
      * Generates early reflections using a multi-tap delay line.
      * Tap parameters are driven by the acoustic engine's reflection analysis.
+     * Each tap is one interpolated block read from a shared delay line; the
+     * taps are then filtered and summed together in SIMD lanes. Delay
+     * changes crossfade over one block.
      *
      * Inputs:
      * - Audio: Input audio signal
@@ -143,10 +150,15 @@ namespace Metasound
 
         // DSP state
         float SampleRate;
-        TArray<float> DelayBuffer;
-        int32 WriteIndex;
-        TArray<float> TapFilterStates;
-        TArray<float> SmoothedGains;
+        float MaxDelaySamples;
+        FAcousticDelayLine DelayLine;
+        TArray<float> TapScratch;
+        alignas(16) float TapDelays[NumTaps];
+        alignas(16) float TapFilterStates[NumTaps];
+        float LastLPFCutoffs[NumTaps];
+        FAcousticSmoothedValue TapGains[NumTaps];
+        FAcousticSmoothedValue TapLPFCoeffs[NumTaps];
+        FAcousticSmoothedValue WetDry;
     };
 
     // ========================================================================
@@ -200,11 +212,12 @@ namespace Metasound
 
         // DSP state
         float SampleRate;
-        TArray<float> DecorrelationDelayL;
-        TArray<float> DecorrelationDelayR;
-        int32 DelayWriteIndex;
+        FAcousticDelayLine DecorrelationLineL;
+        FAcousticDelayLine DecorrelationLineR;
         float AllpassStateL;
         float AllpassStateR;
+        FAcousticSmoothedValue SmoothedWidth;
+        FAcousticSmoothedValue SmoothedAllpassCoeff;
     };
 
     // ========================================================================
@@ -268,16 +281,16 @@ namespace Metasound
      *
      * All-in-one acoustic processing node that applies:
      * - Occlusion filtering
-     * - Early reflections
      * - Spatial width adjustment
      * - Reverb send calculation
      *
-     * This is a convenience node that combines all acoustic
-     * processing into a single graph node.
+     * Gain, LPF, decorrelation and mix run fused in a single pass over
+     * the block, writing both outputs directly, instead of three chained
+     * nodes with their own buffers. Early reflections stay a separate node.
      *
      * Inputs:
      * - Audio: Input mono audio
-     * - Acoustic Params: Full acoustic parameter struct
+     * - Occlusion, LPF Cutoff, Reverb Send, Spatial Width: Acoustic parameters
      * - Wet/Dry: Global wet/dry mix
      *
      * Outputs:
@@ -324,22 +337,21 @@ namespace Metasound
         float SampleRate;
 
         // Occlusion filter state
-        float LPFCoeff;
+        FAcousticSmoothedValue LPFCoeff;
+        FAcousticSmoothedValue OcclusionGain;
         float LPFState;
-        float SmoothedOcclusionGain;
-
-        // Early reflection state
-        static constexpr int32 NumTaps = 8;
-        TArray<float> ReflectionDelayBuffer;
-        int32 ReflectionWriteIndex;
-        TArray<float> ReflectionFilterStates;
+        float LastLPFCutoff;
+        float LastOcclusion;
 
         // Spatial width state
-        TArray<float> DecorrelationDelayL;
-        TArray<float> DecorrelationDelayR;
-        int32 WidthDelayWriteIndex;
+        FAcousticDelayLine DecorrelationLine;
+        int32 DecorrelationDelayL;
+        int32 DecorrelationDelayR;
         float AllpassStateL;
         float AllpassStateR;
+        FAcousticSmoothedValue Width;
+
+        FAcousticSmoothedValue WetDry;
     };
 
 } // namespace Metasound
@@ -24,7 +24,9 @@ public class AcousticEngineEditor : ModuleRules
             "InputCore",
             "LevelEditor",
             "ComponentVisualizers",
-            "PlacementMode"
+            "PlacementMode",
+            "PhysicsCore",
+            "AssetRegistry"
         });
     }
 }
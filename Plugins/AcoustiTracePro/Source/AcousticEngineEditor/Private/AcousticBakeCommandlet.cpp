@@ -0,0 +1,130 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticBakeCommandlet.h"
+#include "AcousticBaker.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectGlobals.h"
+
+UAcousticBakeCommandlet::UAcousticBakeCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+
+    HelpDescription = TEXT("Bake acoustic occlusion and reflection data for the Acoustic Bake Volumes in one or more maps");
+    HelpUsage = TEXT("-run=AcousticBake -Map=<Map>[+<Map>...] [-Full]");
+}
+
+int32 UAcousticBakeCommandlet::Main(const FString& Params)
+{
+    TArray<FString> Tokens;
+    TArray<FString> Switches;
+    TMap<FString, FString> ParamValues;
+    ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+    const FString* MapParam = ParamValues.Find(TEXT("Map"));
+    if (!MapParam || MapParam->IsEmpty())
+    {
+        UE_LOG(LogAcousticBake, Error, TEXT("No map given. Usage: %s"), *HelpUsage);
+        return 1;
+    }
+
+    const bool bIncremental = !Switches.Contains(TEXT("Full"));
+
+    TArray<FString> Maps;
+    MapParam->ParseIntoArray(Maps, TEXT("+"));
+
+    int32 NumFailed = 0;
+    for (const FString& Map : Maps)
+    {
+        if (!BakeMap(Map, bIncremental))
+        {
+            NumFailed++;
+        }
+    }
+
+    UE_LOG(LogAcousticBake, Display, TEXT("AcousticBake: %d map(s), %d failed"), Maps.Num(), NumFailed);
+    return NumFailed > 0 ? 1 : 0;
+}
+
+bool UAcousticBakeCommandlet::BakeMap(const FString& MapName, bool bIncremental)
+{
+    FString PackageName;
+    if (!FPackageName::SearchForPackageOnDisk(MapName, &PackageName))
+    {
+        UE_LOG(LogAcousticBake, Error, TEXT("Map '%s' not found"), *MapName);
+        return false;
+    }
+
+    UPackage* Package = LoadPackage(nullptr, *PackageName, LOAD_None);
+    UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogAcousticBake, Error, TEXT("Failed to load map '%s'"), *PackageName);
+        return false;
+    }
+
+    UE_LOG(LogAcousticBake, Display, TEXT("Baking %s (%s)"), *PackageName, bIncremental ? TEXT("incremental") : TEXT("full"));
+
+    // Collision only - no rendering, navigation, AI or audio
+    World->WorldType = EWorldType::Editor;
+    World->AddToRoot();
+    if (!World->bIsWorldInitialized)
+    {
+        World->InitWorld(UWorld::InitializationValues()
+            .RequiresHitProxies(false)
+            .ShouldSimulatePhysics(false)
+            .EnableTraceCollision(true)
+            .CreatePhysicsScene(true)
+            .CreateNavigation(false)
+            .CreateAISystem(false)
+            .AllowAudioPlayback(false));
+    }
+    World->UpdateWorldComponents(true, false);
+
+    // Sublevels hold geometry and bake volumes too
+    for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+    {
+        if (StreamingLevel)
+        {
+            StreamingLevel->SetShouldBeLoaded(true);
+            StreamingLevel->SetShouldBeVisible(true);
+        }
+    }
+    World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+
+    bool bSuccess = FAcousticBaker::BakeWorld(World, bIncremental);
+
+    // Levels whose volumes gained a new baked asset reference
+    for (ULevel* Level : World->GetLevels())
+    {
+        UPackage* LevelPackage = Level ? Level->GetPackage() : nullptr;
+        if (!LevelPackage || !LevelPackage->IsDirty())
+        {
+            continue;
+        }
+
+        const FString Filename = FPackageName::LongPackageNameToFilename(
+            LevelPackage->GetName(), FPackageName::GetMapPackageExtension());
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Standalone;
+        if (!UPackage::SavePackage(LevelPackage, UWorld::FindWorldInPackage(LevelPackage), *Filename, SaveArgs))
+        {
+            UE_LOG(LogAcousticBake, Error, TEXT("Failed to save %s"), *Filename);
+            bSuccess = false;
+        }
+    }
+
+    World->RemoveFromRoot();
+    World->DestroyWorld(false);
+    CollectGarbage(RF_NoFlags);
+
+    return bSuccess;
+}
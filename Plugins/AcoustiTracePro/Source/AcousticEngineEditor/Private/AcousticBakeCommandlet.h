@@ -0,0 +1,34 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AcousticBakeCommandlet.generated.h"
+
+/**
+ * Acoustic Bake Commandlet
+ *
+ * Headless acoustic bake for build machines:
+ *
+ *   UnrealEditor-Cmd Project.uproject -run=AcousticBake -Map=/Game/Maps/Level1+/Game/Maps/Level2 [-Full]
+ *
+ * Loads each map with its sublevels, bakes every Acoustic Bake Volume and
+ * saves the baked assets plus any level that gained a new asset reference.
+ * Bakes are incremental unless -Full is given. Returns non-zero if any map
+ * or volume failed.
+ */
+UCLASS()
+class UAcousticBakeCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UAcousticBakeCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    /** Load, bake and save a single map */
+    bool BakeMap(const FString& MapName, bool bIncremental);
+};
@@ -0,0 +1,587 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#include "AcousticBaker.h"
+#include "AcousticBakedData.h"
+#include "AcousticSettings.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "CollisionQueryParams.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Async/ParallelFor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "Materials/MaterialInterface.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Engine/OverlapResult.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include <atomic>
+
+#define LOCTEXT_NAMESPACE "AcousticBaker"
+
+DEFINE_LOG_CATEGORY(LogAcousticBake);
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+namespace AcousticBake
+{
+    /** Order-independent hash of the static geometry (and its collision and surfaces) blocking the bake channel inside a cell */
+    static uint32 HashCellGeometry(UWorld* World, const FBox& CellBox, ECollisionChannel Channel, const FCollisionQueryParams& QueryParams)
+    {
+        TArray<FOverlapResult> Overlaps;
+        World->OverlapMultiByChannel(Overlaps, CellBox.GetCenter(), FQuat::Identity, Channel,
+            FCollisionShape::MakeBox(CellBox.GetExtent()), QueryParams);
+
+        TArray<uint32, TInlineAllocator<32>> ComponentHashes;
+        for (const FOverlapResult& Overlap : Overlaps)
+        {
+            UPrimitiveComponent* Component = Overlap.GetComponent();
+            if (!Component || !Overlap.bBlockingHit)
+            {
+                continue;
+            }
+
+            // Identity, placement, shape and surface - anything that changes what a ray would hit
+            const FTransform& Transform = Component->GetComponentTransform();
+            const FVector Location = Transform.GetLocation();
+            const FQuat Rotation = Transform.GetRotation();
+            const FVector Scale = Transform.GetScale3D();
+            const FVector BoundsExtent = Component->Bounds.BoxExtent;
+            const UPhysicalMaterial* PhysMat = Component->BodyInstance.GetSimplePhysicalMaterial();
+
+            uint32 Hash = GetTypeHash(Component->GetPathName());
+            Hash = FCrc::MemCrc32(&Location, sizeof(Location), Hash);
+            Hash = FCrc::MemCrc32(&Rotation, sizeof(Rotation), Hash);
+            Hash = FCrc::MemCrc32(&Scale, sizeof(Scale), Hash);
+            Hash = FCrc::MemCrc32(&BoundsExtent, sizeof(BoundsExtent), Hash);
+            Hash = HashCombine(Hash, GetTypeHash(Component->GetCollisionProfileName()));
+            Hash = HashCombine(Hash, GetTypeHash(PhysMat ? PhysMat->GetPathName() : FString()));
+
+            // The collision itself: a mesh edited or swapped in place keeps its bounds
+            if (const UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Component))
+            {
+                const UStaticMesh* Mesh = MeshComponent->GetStaticMesh();
+                Hash = HashCombine(Hash, GetTypeHash(Mesh ? Mesh->GetPathName() : FString()));
+
+                // Complex collision is built from the render mesh
+                const FStaticMeshRenderData* RenderData = Mesh ? Mesh->GetRenderData() : nullptr;
+                Hash = HashCombine(Hash, GetTypeHash(RenderData ? RenderData->DerivedDataKey : FString()));
+            }
+
+            if (const UBodySetup* BodySetup = Component->GetBodySetup())
+            {
+                Hash = HashCombine(Hash, GetTypeHash(BodySetup->BodySetupGuid));
+                Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(BodySetup->GetCollisionTraceFlag())));
+            }
+
+            // Complex collision hits report the physical material of the section's material
+            for (int32 MaterialIndex = 0; MaterialIndex < Component->GetNumMaterials(); MaterialIndex++)
+            {
+                const UMaterialInterface* Material = Component->GetMaterial(MaterialIndex);
+                const UPhysicalMaterial* SectionPhysMat = Material ? Material->GetPhysicalMaterial() : nullptr;
+                Hash = HashCombine(Hash, GetTypeHash(SectionPhysMat ? SectionPhysMat->GetPathName() : FString()));
+            }
+
+            ComponentHashes.Add(Hash);
+        }
+
+        ComponentHashes.Sort();
+        uint32 CellHash = ComponentHashes.Num();
+        for (const uint32 Hash : ComponentHashes)
+        {
+            CellHash = HashCombine(CellHash, Hash);
+        }
+        return CellHash;
+    }
+
+    /** Grow a cell set by Reach cells along every axis (separable box dilation) */
+    static TBitArray<> DilateCells(const TBitArray<>& Cells, const FIntVector& Dims, int32 Reach)
+    {
+        TBitArray<> Result = Cells;
+        const int32 Strides[3] = { 1, Dims.X, Dims.X * Dims.Y };
+        const int32 Lengths[3] = { Dims.X, Dims.Y, Dims.Z };
+        TArray<int32> Prefix;
+
+        for (int32 Axis = 0; Axis < 3; Axis++)
+        {
+            const TBitArray<> Source = Result;
+            const int32 Length = Lengths[Axis];
+            const int32 Stride = Strides[Axis];
+            Prefix.SetNumUninitialized(Length + 1);
+
+            for (int32 Start = 0; Start < Source.Num(); Start++)
+            {
+                // Visit each line along this axis once, from its first cell
+                if ((Start / Stride) % Length != 0)
+                {
+                    continue;
+                }
+
+                Prefix[0] = 0;
+                for (int32 i = 0; i < Length; i++)
+                {
+                    Prefix[i + 1] = Prefix[i] + (Source[Start + i * Stride] ? 1 : 0);
+                }
+                for (int32 i = 0; i < Length; i++)
+                {
+                    const int32 Lo = FMath::Max(i - Reach, 0);
+                    const int32 Hi = FMath::Min(i + Reach, Length - 1);
+                    Result[Start + i * Stride] = Prefix[Hi + 1] - Prefix[Lo] > 0;
+                }
+            }
+        }
+
+        return Result;
+    }
+}
+
+// ============================================================================
+// BAKE
+// ============================================================================
+
+bool FAcousticBaker::BakeVolume(AAcousticBakeVolume* Volume, bool bIncremental, FString& OutError)
+{
+    UWorld* World = Volume ? Volume->GetWorld() : nullptr;
+    const UAcousticSettings* Settings = UAcousticSettings::Get();
+    if (!World || !Settings)
+    {
+        OutError = TEXT("Bake volume is not in a world");
+        return false;
+    }
+
+    // Grid over the volume bounds
+    FVector Origin, Extent;
+    Volume->GetActorBounds(false, Origin, Extent);
+
+    const float CellSize = Volume->CellSize;
+    const FVector GridOrigin = Origin - Extent;
+    const FIntVector Dims(
+        FMath::Max(1, FMath::CeilToInt(2.0 * Extent.X / CellSize)),
+        FMath::Max(1, FMath::CeilToInt(2.0 * Extent.Y / CellSize)),
+        FMath::Max(1, FMath::CeilToInt(2.0 * Extent.Z / CellSize)));
+    const int64 NumCells64 = int64(Dims.X) * Dims.Y * Dims.Z;
+
+    if (NumCells64 > UAcousticBakedData::MaxCells)
+    {
+        OutError = FString::Printf(TEXT("%lld cells exceeds the limit of %d - increase CellSize"),
+            NumCells64, UAcousticBakedData::MaxCells);
+        return false;
+    }
+
+    const int32 NumCells = static_cast<int32>(NumCells64);
+    const int32 SliceSize = Dims.X * Dims.Y;
+    const ECollisionChannel Channel = Settings->AudioOcclusionChannel;
+
+    auto GetCellCoord = [&](int32 Cell)
+    {
+        const int32 Z = Cell / SliceSize;
+        const int32 Y = (Cell - Z * SliceSize) / Dims.X;
+        return FIntVector(Cell - Z * SliceSize - Y * Dims.X, Y, Z);
+    };
+    auto GetCellCenter = [&](const FIntVector& Coord)
+    {
+        return GridOrigin + (FVector(Coord) + 0.5) * CellSize;
+    };
+
+    // Static geometry only - movable actors are traced live at runtime
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AcousticBake));
+    QueryParams.bTraceComplex = Settings->bUseComplexCollision;
+    QueryParams.bReturnPhysicalMaterial = true;
+    QueryParams.MobilityType = EQueryMobilityType::Static;
+
+    // Everything every cell depends on; a change invalidates the whole bake
+    uint32 SettingsHash = GetTypeHash(UAcousticBakedData::CurrentVersion);
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(GridOrigin));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(Dims));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(CellSize));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(Volume->MaxBakeDistance));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(Volume->ProbeRayCount));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(Volume->OpenCellProbeRadius));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(Settings->MaxTraceDistance));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(static_cast<uint8>(Channel)));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(Settings->bUseComplexCollision ? 1 : 0));
+
+    // Reuse the previous bake for cells whose surroundings did not change
+    const UAcousticBakedData* Previous = Volume->BakedData;
+    const bool bCanReuse = bIncremental && Previous && Previous->IsValid() &&
+        Previous->BakeSettingsHash == SettingsHash &&
+        Previous->CellHashes.Num() == NumCells &&
+        Previous->Probes.Num() == NumCells &&
+        Previous->ProbeTaps.Num() == NumCells * UAcousticBakedData::MaxProbeTaps;
+
+    FScopedSlowTask SlowTask(4.0f * Dims.Z, FText::Format(
+        LOCTEXT("BakingVolume", "Baking acoustics for {0}"), FText::FromString(Volume->GetActorLabel())));
+    SlowTask.MakeDialog(true);
+
+    // Run a phase across all cores, one Z slice at a time so progress and cancel stay responsive
+    auto ForEachCell = [&](TFunctionRef<void(int32 Cell)> Body)
+    {
+        for (int32 Z = 0; Z < Dims.Z; Z++)
+        {
+            SlowTask.EnterProgressFrame(1.0f);
+            if (SlowTask.ShouldCancel())
+            {
+                return false;
+            }
+            ParallelFor(SliceSize, [&](int32 i) { Body(Z * SliceSize + i); });
+        }
+        return true;
+    };
+
+    // Hash the geometry in each cell to find what changed
+    TArray<uint32> CellHashes;
+    CellHashes.SetNumZeroed(NumCells);
+    const FVector CellExtent(CellSize * 0.5);
+    if (!ForEachCell([&](int32 Cell)
+        {
+            const FVector Center = GetCellCenter(GetCellCoord(Cell));
+            CellHashes[Cell] = AcousticBake::HashCellGeometry(World, FBox(Center - CellExtent, Center + CellExtent), Channel, QueryParams);
+        }))
+    {
+        OutError = TEXT("Bake cancelled");
+        return false;
+    }
+
+    TBitArray<> DirtyCells(!bCanReuse, NumCells);
+    int32 NumDirty = bCanReuse ? 0 : NumCells;
+    if (bCanReuse)
+    {
+        for (int32 Cell = 0; Cell < NumCells; Cell++)
+        {
+            if (CellHashes[Cell] != Previous->CellHashes[Cell])
+            {
+                DirtyCells[Cell] = true;
+                NumDirty++;
+            }
+        }
+    }
+
+    if (NumDirty == 0)
+    {
+        UE_LOG(LogAcousticBake, Log, TEXT("'%s' is up to date"), *Volume->GetActorLabel());
+        return true;
+    }
+
+    // A changed cell affects every pair whose segment can cross it, and every probe whose rays can reach it
+    const int32 Reach = FMath::CeilToInt(Volume->MaxBakeDistance / CellSize);
+    const TBitArray<> RowsToBake = bCanReuse ?
+        AcousticBake::DilateCells(DirtyCells, Dims, Reach) : TBitArray<>(true, NumCells);
+    const TBitArray<> ProbesToBake = bCanReuse ?
+        AcousticBake::DilateCells(DirtyCells, Dims, FMath::CeilToInt(Settings->MaxTraceDistance / CellSize)) : TBitArray<>(true, NumCells);
+
+    // Voxelize: a cell is open if its center lies in the volume and clear of static geometry
+    TArray<uint8> CellFlags;
+    CellFlags.SetNumZeroed(NumCells);
+    const FCollisionShape OpenProbe = FCollisionShape::MakeSphere(Volume->OpenCellProbeRadius);
+
+    if (!ForEachCell([&](int32 Cell)
+        {
+            if (!DirtyCells[Cell])
+            {
+                CellFlags[Cell] = Previous->CellFlags[Cell] & UAcousticBakedData::CellFlag_Open;
+                return;
+            }
+
+            const FVector Center = GetCellCenter(GetCellCoord(Cell));
+            if (Volume->EncompassesPoint(Center) &&
+                !World->OverlapBlockingTestByChannel(Center, FQuat::Identity, Channel, OpenProbe, QueryParams))
+            {
+                CellFlags[Cell] = UAcousticBakedData::CellFlag_Open;
+            }
+        }))
+    {
+        OutError = TEXT("Bake cancelled");
+        return false;
+    }
+
+    // Reflection probe at every open cell center, over the full sphere
+    TArray<FVector> Directions;
+    Directions.Reserve(Volume->ProbeRayCount);
+    const float GoldenAngle = PI * (3.0f - FMath::Sqrt(5.0f));
+    for (int32 i = 0; i < Volume->ProbeRayCount; i++)
+    {
+        const float Z = 1.0f - (2.0f * i + 1.0f) / Volume->ProbeRayCount;
+        const float Radius = FMath::Sqrt(1.0f - Z * Z);
+        const float Phi = GoldenAngle * i;
+        Directions.Add(FVector(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z));
+    }
+
+    TArray<FAcousticBakedProbe> Probes;
+    Probes.SetNum(NumCells);
+    TArray<FAcousticBakedTap> ProbeTaps;
+    ProbeTaps.SetNum(NumCells * UAcousticBakedData::MaxProbeTaps);
+    std::atomic<int32> NumProbesBaked = 0;
+
+    if (!ForEachCell([&](int32 Cell)
+        {
+            if (!(CellFlags[Cell] & UAcousticBakedData::CellFlag_Open))
+            {
+                return;
+            }
+
+            const int32 FirstTap = Cell * UAcousticBakedData::MaxProbeTaps;
+            if (ProbesToBake[Cell])
+            {
+                BakeProbe(World, GetCellCenter(GetCellCoord(Cell)), Directions, Settings->MaxTraceDistance, QueryParams,
+                    Probes[Cell], &ProbeTaps[FirstTap]);
+                NumProbesBaked++;
+            }
+            else
+            {
+                Probes[Cell] = Previous->Probes[Cell];
+                FMemory::Memcpy(&ProbeTaps[FirstTap], &Previous->ProbeTaps[FirstTap], UAcousticBakedData::MaxProbeTaps * sizeof(FAcousticBakedTap));
+            }
+            CellFlags[Cell] |= UAcousticBakedData::CellFlag_Probe;
+        }))
+    {
+        OutError = TEXT("Bake cancelled");
+        return false;
+    }
+
+    // Trace each open pair within range once, from the lower cell; iterating
+    // neighbours in Z, Y, X order keeps every cell's target list sorted
+    const double MaxDistSq = FMath::Square(double(Volume->MaxBakeDistance));
+    TArray<TArray<uint32>> Rows;
+    Rows.SetNum(NumCells);
+    std::atomic<int64> NumTraces = 0;
+    std::atomic<int32> NumRowsBaked = 0;
+
+    if (!ForEachCell([&](int32 Cell)
+        {
+            if (!(CellFlags[Cell] & UAcousticBakedData::CellFlag_Open))
+            {
+                return;
+            }
+
+            if (!RowsToBake[Cell])
+            {
+                Rows[Cell] = TArray<uint32>(Previous->GetOcclusionRow(Cell));
+                return;
+            }
+
+            const FIntVector C = GetCellCoord(Cell);
+            const FVector From = GetCellCenter(C);
+            TArray<uint32>& Row = Rows[Cell];
+            int64 CellTraces = 0;
+
+            for (int32 Z = C.Z; Z <= FMath::Min(C.Z + Reach, Dims.Z - 1); Z++)
+            {
+                for (int32 Y = FMath::Max(C.Y - Reach, 0); Y <= FMath::Min(C.Y + Reach, Dims.Y - 1); Y++)
+                {
+                    for (int32 X = FMath::Max(C.X - Reach, 0); X <= FMath::Min(C.X + Reach, Dims.X - 1); X++)
+                    {
+                        const int32 Target = X + Y * Dims.X + Z * SliceSize;
+                        if (Target <= Cell || !(CellFlags[Target] & UAcousticBakedData::CellFlag_Open))
+                        {
+                            continue;
+                        }
+
+                        const FVector To = GetCellCenter(FIntVector(X, Y, Z));
+                        if (FVector::DistSquared(From, To) > MaxDistSq)
+                        {
+                            continue;
+                        }
+
+                        FHitResult Hit;
+                        CellTraces++;
+                        if (World->LineTraceSingleByChannel(Hit, From, To, Channel, QueryParams))
+                        {
+                            const UPhysicalMaterial* PhysMat = Hit.PhysMaterial.Get();
+                            const uint8 SurfaceType = PhysMat ? static_cast<uint8>(PhysMat->SurfaceType) : static_cast<uint8>(SurfaceType_Default);
+                            Row.Add((static_cast<uint32>(Target) << UAcousticBakedData::EntryCellShift) | SurfaceType);
+                        }
+                    }
+                }
+            }
+
+            NumTraces += CellTraces;
+            NumRowsBaked++;
+        }))
+    {
+        OutError = TEXT("Bake cancelled");
+        return false;
+    }
+
+    // Flatten rows into the CSR table
+    TArray<uint32> Offsets;
+    Offsets.SetNumUninitialized(NumCells + 1);
+    TArray<uint32> Entries;
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        Offsets[Cell] = Entries.Num();
+        Entries.Append(Rows[Cell]);
+    }
+    Offsets[NumCells] = Entries.Num();
+    Rows.Empty();
+
+    // Write the asset
+    UAcousticBakedData* BakedData = FindOrCreateBakedData(Volume);
+    if (!BakedData)
+    {
+        OutError = TEXT("Could not create the baked data asset");
+        return false;
+    }
+
+    BakedData->Modify();
+    BakedData->Version = UAcousticBakedData::CurrentVersion;
+    BakedData->GridOrigin = GridOrigin;
+    BakedData->CellSize = CellSize;
+    BakedData->GridDims = Dims;
+    BakedData->MaxBakeDistance = Volume->MaxBakeDistance;
+    BakedData->CellFlags = MoveTemp(CellFlags);
+    BakedData->OcclusionOffsets = MoveTemp(Offsets);
+    BakedData->Probes = MoveTemp(Probes);
+    BakedData->ProbeTaps = MoveTemp(ProbeTaps);
+    BakedData->CellHashes = MoveTemp(CellHashes);
+    BakedData->BakeSettingsHash = SettingsHash;
+    BakedData->SetOcclusionEntries(Entries);
+
+    const int64 Bytes = BakedData->CellFlags.Num() + BakedData->OcclusionOffsets.Num() * sizeof(uint32) + Entries.Num() * sizeof(uint32) +
+        BakedData->Probes.Num() * sizeof(FAcousticBakedProbe) + BakedData->ProbeTaps.Num() * sizeof(FAcousticBakedTap);
+    UE_LOG(LogAcousticBake, Log, TEXT("Baked '%s' (%s): %d x %d x %d cells, %d changed, %d rows / %d probes rebaked, %lld traces, %d occluded pairs, %.2f MB"),
+        *Volume->GetActorLabel(), bCanReuse ? TEXT("incremental") : TEXT("full"), Dims.X, Dims.Y, Dims.Z, NumDirty,
+        NumRowsBaked.load(), NumProbesBaked.load(), NumTraces.load(), Entries.Num(), Bytes / (1024.0 * 1024.0));
+
+    if (!SaveBakedData(BakedData))
+    {
+        OutError = FString::Printf(TEXT("Failed to save %s"), *BakedData->GetPathName());
+        return false;
+    }
+
+    return true;
+}
+
+void FAcousticBaker::BakeProbe(UWorld* World, const FVector& Center, const TArray<FVector>& Directions, float MaxDistance,
+    const FCollisionQueryParams& QueryParams, FAcousticBakedProbe& OutProbe, FAcousticBakedTap* OutTaps)
+{
+    const UAcousticSettings* Settings = UAcousticSettings::Get();
+
+    TArray<FAcousticBakedTap, TInlineAllocator<256>> Hits;
+    TMap<uint8, int32> SurfaceCounts;
+    double TotalDistance = 0.0;
+
+    for (const FVector& Direction : Directions)
+    {
+        FHitResult Hit;
+        if (!World->LineTraceSingleByChannel(Hit, Center, Center + Direction * MaxDistance, Settings->AudioOcclusionChannel, QueryParams))
+        {
+            continue;
+        }
+
+        const UPhysicalMaterial* PhysMat = Hit.PhysMaterial.Get();
+        FAcousticBakedTap& Tap = Hits.AddDefaulted_GetRef();
+        Tap.Distance = Hit.Distance;
+        Tap.Direction = FVector3f(Direction);
+        Tap.SurfaceType = PhysMat ? static_cast<uint8>(PhysMat->SurfaceType) : static_cast<uint8>(SurfaceType_Default);
+
+        SurfaceCounts.FindOrAdd(Tap.SurfaceType)++;
+        TotalDistance += Hit.Distance;
+    }
+
+    OutProbe = FAcousticBakedProbe();
+    OutProbe.OpenFraction = 1.0f - float(Hits.Num()) / FMath::Max(Directions.Num(), 1);
+    OutProbe.MeanFreePath = Hits.Num() > 0 ? float(TotalDistance / Hits.Num()) : MaxDistance;
+
+    // Earliest reflectors become the taps
+    Hits.Sort([](const FAcousticBakedTap& A, const FAcousticBakedTap& B) { return A.Distance < B.Distance; });
+    OutProbe.NumTaps = static_cast<uint8>(FMath::Min(Hits.Num(), UAcousticBakedData::MaxProbeTaps));
+    for (int32 i = 0; i < OutProbe.NumTaps; i++)
+    {
+        OutTaps[i] = Hits[i];
+    }
+
+    // Keep the most-hit surfaces as the room's material mix
+    SurfaceCounts.ValueSort(TGreater<int32>());
+    int32 Slot = 0;
+    for (const TPair<uint8, int32>& Surface : SurfaceCounts)
+    {
+        if (Slot == FAcousticBakedProbe::MaxSurfaces)
+        {
+            break;
+        }
+        OutProbe.SurfaceTypes[Slot] = Surface.Key;
+        OutProbe.SurfaceWeights[Slot] = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(255.0f * Surface.Value / Hits.Num()), 1, 255));
+        Slot++;
+    }
+}
+
+bool FAcousticBaker::BakeWorld(UWorld* World, bool bIncremental)
+{
+    if (!World)
+    {
+        return false;
+    }
+
+    int32 NumBaked = 0;
+    int32 NumFailed = 0;
+    for (TActorIterator<AAcousticBakeVolume> It(World); It; ++It)
+    {
+        FString Error;
+        if (BakeVolume(*It, bIncremental, Error))
+        {
+            NumBaked++;
+        }
+        else
+        {
+            UE_LOG(LogAcousticBake, Error, TEXT("Bake of '%s' failed: %s"), *It->GetActorLabel(), *Error);
+            NumFailed++;
+        }
+    }
+
+    UE_LOG(LogAcousticBake, Log, TEXT("Acoustic bake finished: %d volume(s) baked, %d failed"), NumBaked, NumFailed);
+    return NumFailed == 0;
+}
+
+// ============================================================================
+// ASSETS
+// ============================================================================
+
+UAcousticBakedData* FAcousticBaker::FindOrCreateBakedData(AAcousticBakeVolume* Volume)
+{
+    if (Volume->BakedData)
+    {
+        return Volume->BakedData;
+    }
+
+    const FString MapName = FPackageName::GetShortName(Volume->GetPackage()->GetName());
+    const FString AssetName = FString::Printf(TEXT("%s_%s_AcousticBake"), *MapName, *Volume->GetName());
+    const FString PackageName = FString::Printf(TEXT("/Game/Acoustics/%s"), *AssetName);
+
+    UPackage* Package = CreatePackage(*PackageName);
+    if (!Package)
+    {
+        return nullptr;
+    }
+
+    UAcousticBakedData* BakedData = NewObject<UAcousticBakedData>(Package, *AssetName, RF_Public | RF_Standalone);
+    FAssetRegistryModule::AssetCreated(BakedData);
+
+    // The volume holds a hard reference so the data streams with its level
+    Volume->Modify();
+    Volume->BakedData = BakedData;
+    Volume->MarkPackageDirty();
+
+    return BakedData;
+}
+
+bool FAcousticBaker::SaveBakedData(UAcousticBakedData* BakedData)
+{
+    UPackage* Package = BakedData->GetPackage();
+    Package->MarkPackageDirty();
+
+    const FString Filename = FPackageName::LongPackageNameToFilename(
+        Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    return UPackage::SavePackage(Package, BakedData, *Filename, SaveArgs);
+}
+
+#undef LOCTEXT_NAMESPACE
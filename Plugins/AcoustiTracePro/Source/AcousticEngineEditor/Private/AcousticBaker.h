@@ -0,0 +1,50 @@
+// Copyright AcoustiTrace Pro. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AAcousticBakeVolume;
+class UAcousticBakedData;
+class UWorld;
+struct FAcousticBakedProbe;
+struct FAcousticBakedTap;
+struct FCollisionQueryParams;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAcousticBake, Log, All);
+
+/**
+ * Acoustic Baker
+ *
+ * Offline bake of static acoustic data for AAcousticBakeVolume actors.
+ * Voxelizes the volume, marks cells embedded in static geometry as closed,
+ * then traces every pair of open cells within the volume's MaxBakeDistance
+ * against static geometry only, and traces a full-sphere reflection probe
+ * from every open cell center. The result is written to the volume's
+ * UAcousticBakedData asset, which is created under /Game/Acoustics if missing.
+ *
+ * Every phase runs across all cores. Incremental bakes hash the static
+ * geometry in each cell (placement, mesh asset, collision setup and surface
+ * materials) and only rebake what a changed cell can affect:
+ * occlusion rows within MaxBakeDistance and probes within MaxTraceDistance.
+ */
+class FAcousticBaker
+{
+public:
+    /** Bake a single volume. Returns false and fills OutError on failure */
+    static bool BakeVolume(AAcousticBakeVolume* Volume, bool bIncremental, FString& OutError);
+
+    /** Bake every bake volume in a world. Returns false if any volume failed */
+    static bool BakeWorld(UWorld* World, bool bIncremental);
+
+private:
+    /** Trace one reflection probe; OutTaps must hold UAcousticBakedData::MaxProbeTaps entries */
+    static void BakeProbe(UWorld* World, const FVector& Center, const TArray<FVector>& Directions, float MaxDistance,
+        const FCollisionQueryParams& QueryParams, FAcousticBakedProbe& OutProbe, FAcousticBakedTap* OutTaps);
+
+    /** Baked data asset for a volume, created under /Game/Acoustics if missing */
+    static UAcousticBakedData* FindOrCreateBakedData(AAcousticBakeVolume* Volume);
+
+    /** Save the package holding baked data */
+    static bool SaveBakedData(UAcousticBakedData* BakedData);
+};
@@ -1,6 +1,8 @@
 // Copyright AcoustiTrace Pro. All Rights Reserved.
 
 #include "AcousticEngineEditorModule.h"
+#include "AcousticBaker.h"
+#include "HAL/IConsoleManager.h"
 #include "UnrealEdGlobals.h"
 #include "Editor/UnrealEdEngine.h"
 
@@ -19,6 +21,9 @@ void FAcousticEngineEditorModule::StartupModule()
     // Register placement mode items
     RegisterPlacementModeItems();
 
+    // Register bake commands
+    RegisterConsoleCommands();
+
     UE_LOG(LogTemp, Log, TEXT("AcoustiTrace Pro - Editor Module Started"));
 }
 
@@ -29,6 +34,9 @@ void FAcousticEngineEditorModule::ShutdownModule()
     // Unregister visualizers
     UnregisterVisualizers();
 
+    // Unregister bake commands
+    UnregisterConsoleCommands();
+
     UE_LOG(LogTemp, Log, TEXT("AcoustiTrace Pro - Editor Module Shut Down"));
 }
 
@@ -61,7 +69,29 @@ void FAcousticEngineEditorModule::RegisterPropertyCustomizations()
 void FAcousticEngineEditorModule::RegisterPlacementModeItems()
 {
     // Register acoustic actors in the Place Actors panel under a custom "Audio" category
-    // AAcousticZoneVolume, AAcousticPortalVolume
+    // AAcousticZoneVolume, AAcousticPortalVolume, AAcousticBakeVolume
+}
+
+void FAcousticEngineEditorModule::RegisterConsoleCommands()
+{
+    ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Acoustic.Bake"),
+        TEXT("Bake acoustic data for every Acoustic Bake Volume in the current level. Only changed cells are rebaked unless 'Full' is given"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            const bool bFull = Args.ContainsByPredicate([](const FString& Arg) { return Arg.Equals(TEXT("Full"), ESearchCase::IgnoreCase); });
+            FAcousticBaker::BakeWorld(World, !bFull);
+        }),
+        ECVF_Default));
+}
+
+void FAcousticEngineEditorModule::UnregisterConsoleCommands()
+{
+    for (IConsoleObject* Command : ConsoleCommands)
+    {
+        IConsoleManager::Get().UnregisterConsoleObject(Command);
+    }
+    ConsoleCommands.Empty();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class IConsoleObject;
+
 /**
  * Acoustic Engine Editor Module
  *
@@ -14,6 +16,7 @@
  * - Debug ray drawing
  * - Property customization
  * - Placement mode integration
+ * - Acoustic baking (Acoustic.Bake)
  */
 class FAcousticEngineEditorModule : public IModuleInterface
 {
@@ -34,6 +37,15 @@ private:
     /** Register placement mode items */
     void RegisterPlacementModeItems();
 
+    /** Register editor console commands */
+    void RegisterConsoleCommands();
+
+    /** Unregister editor console commands */
+    void UnregisterConsoleCommands();
+
     /** Visualizer registration handles */
     TArray<FName> RegisteredVisualizerNames;
+
+    /** Registered console commands */
+    TArray<IConsoleObject*> ConsoleCommands;
 };